@@ -0,0 +1,190 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <ihex/hex_record.hpp>
+#include <ihex/version.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief Hex codec kernel types
+ *
+ */
+enum class HexCodecKernelType : uint8_t
+{
+    /**
+     * @brief Portable table-driven implementation
+     *
+     */
+    KERNEL_SCALAR = 0,
+
+    /**
+     * @brief x86 SSE2 implementation (16 hex digits per decode step, 16 bytes per encode step)
+     *
+     */
+    KERNEL_SSE2 = 1,
+
+    /**
+     * @brief x86 SSSE3 implementation (16 hex digits per decode step, 16 bytes per encode step)
+     *
+     */
+    KERNEL_SSSE3 = 2,
+
+    /**
+     * @brief x86 AVX2 implementation (32 hex digits per decode step, 32 bytes per encode step)
+     *
+     */
+    KERNEL_AVX2 = 3,
+
+    KERNEL_MIN = KERNEL_SCALAR,
+    KERNEL_MAX = KERNEL_AVX2
+};
+
+/**
+ * @brief HexCodec class
+ *
+ * Conversion helper functions between ASCII hex digits and binary data,
+ * used by the record parser and encoder. None of the functions allocate memory.
+ *
+ */
+class HexCodec final
+{
+    public:
+        /**
+         * @brief HexCodec provides static functions only
+         *
+         */
+        HexCodec() = delete;
+
+        /**
+         * @brief Decode a single hex digit
+         *
+         * @param character Hex digit character ([0-9], [A-F] or [a-f])
+         * @param value Decoded value of the digit
+         * @return true Successfully decoded the digit
+         * @return false Character is not a hex digit
+         */
+        static bool decodeNibble(char character, HexDataType& value);
+
+        /**
+         * @brief Decode a byte from two hex digits
+         *
+         * @param text Pointer to two hex digits (most significant digit first)
+         * @param value Decoded byte
+         * @return true Successfully decoded the byte
+         * @return false Any of the characters is not a hex digit
+         */
+        static bool decodeByte(const char* text, HexDataType& value);
+
+        /**
+         * @brief Decode a 16-bit word from four hex digits
+         *
+         * @param text Pointer to four hex digits (most significant digit first)
+         * @param value Decoded word
+         * @return true Successfully decoded the word
+         * @return false Any of the characters is not a hex digit
+         */
+        static bool decodeWord(const char* text, uint16_t& value);
+
+        /**
+         * @brief Encode a byte to two uppercase hex digits
+         *
+         * @param value Byte to encode
+         * @param text Pointer to the two characters to encode to (most significant digit first)
+         */
+        static void encodeByte(HexDataType value, char* text);
+
+        /**
+         * @brief Encode a 16-bit word to four uppercase hex digits
+         *
+         * @param value Word to encode
+         * @param text Pointer to the four characters to encode to (most significant digit first)
+         */
+        static void encodeWord(uint16_t value, char* text);
+
+        /**
+         * @brief Encode data to uppercase hex digits
+         *
+         * @param data Pointer to the data to encode
+         * @param dataSize Size of the data to encode
+         * @param text Pointer to the (2 * dataSize) characters to encode to
+         * @note The fastest kernel supported by the CPU is used (see getKernel)
+         */
+        static void encode(const HexDataType* data, HexDataSizeType dataSize, char* text);
+
+        /**
+         * @brief Encode data to uppercase hex digits with the selected kernel
+         *
+         * @param kernel Kernel to encode the data with
+         * @throw std::domain_error kernel is not supported by the CPU or the build
+         * @param data Pointer to the data to encode
+         * @param dataSize Size of the data to encode
+         * @param text Pointer to the (2 * dataSize) characters to encode to
+         */
+        static void encode(HexCodecKernelType kernel, const HexDataType* data, HexDataSizeType dataSize, char* text);
+
+        /**
+         * @brief Decode data from hex digits
+         *
+         * @param text Pointer to (2 * dataSize) hex digits
+         * @param data Pointer to the data to decode to
+         * @param dataSize Size of the data to decode
+         * @note The fastest kernel supported by the CPU is used (see getKernel)
+         * @return true Successfully decoded all of the data
+         * @return false Any of the characters is not a hex digit (data content is undefined)
+         */
+        static bool decode(const char* text, HexDataType* data, HexDataSizeType dataSize);
+
+        /**
+         * @brief Decode data from hex digits with the selected kernel
+         *
+         * @param kernel Kernel to decode the data with
+         * @throw std::domain_error kernel is not supported by the CPU or the build
+         * @param text Pointer to (2 * dataSize) hex digits
+         * @param data Pointer to the data to decode to
+         * @param dataSize Size of the data to decode
+         * @return true Successfully decoded all of the data
+         * @return false Any of the characters is not a hex digit (data content is undefined)
+         */
+        static bool decode(HexCodecKernelType kernel, const char* text, HexDataType* data, HexDataSizeType dataSize);
+
+        /**
+         * @brief Get the kernel used by the codec functions
+         *
+         * @note Kernel is selected once at runtime, based on the CPU features (for decoding and encoding)
+         * @return HexCodecKernelType Fastest supported kernel
+         */
+        static HexCodecKernelType getKernel();
+
+        /**
+         * @brief Check if the kernel is supported
+         *
+         * @param kernel Kernel
+         * @return true Kernel is supported by the CPU and the build
+         * @return false Kernel is not supported
+         */
+        static bool isKernelSupported(HexCodecKernelType kernel);
+};
+
+END_NAMESPACE_LIBIHEX
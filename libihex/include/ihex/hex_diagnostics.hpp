@@ -0,0 +1,229 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <stdint.h>
+#include <ihex/version.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief Hex error types
+ *
+ */
+enum class HexErrorType : uint8_t
+{
+    /**
+     * @brief Line is not a valid record
+     *
+     */
+    ERROR_INVALID_RECORD = 0,
+
+    /**
+     * @brief Record checksum mismatch
+     *
+     */
+    ERROR_CHECKSUM_MISMATCH = 1,
+
+    /**
+     * @brief Valid record could not be pushed to any section
+     *
+     */
+    ERROR_REJECTED_RECORD = 2,
+
+    ERROR_MIN = ERROR_INVALID_RECORD,
+    ERROR_MAX = ERROR_REJECTED_RECORD
+};
+
+/**
+ * @brief Default maximum number of errors kept by HexDiagnostics
+ *
+ */
+static constexpr size_t DEFAULT_HEX_DIAGNOSTICS_ERROR_COUNT{16};
+
+/**
+ * @brief Hex error found in the input
+ *
+ */
+struct HexError
+{
+    /**
+     * @brief Number of the line (lines are numbered from 1)
+     *
+     */
+    size_t line;
+
+    /**
+     * @brief Offset of the first character of the line from the start of the input
+     *
+     */
+    size_t offset;
+
+    /**
+     * @brief Type of the error
+     *
+     */
+    HexErrorType errorType;
+};
+
+/**
+ * @brief Vector of hex errors
+ *
+ */
+typedef std::vector<HexError> HexErrorVector;
+
+/**
+ * @brief HexDiagnostics class
+ *
+ * Collects the first errors found in the input, up to the maximum number
+ * of errors. Storage for the errors is allocated up front.
+ *
+ */
+class HexDiagnostics final
+{
+    public:
+        /**
+         * @brief Construct a new HexDiagnostics object
+         *
+         * @param maximumErrorCount Maximum number of errors kept
+         */
+        explicit HexDiagnostics(size_t maximumErrorCount = DEFAULT_HEX_DIAGNOSTICS_ERROR_COUNT);
+
+        /**
+         * @brief Copy-construct a new HexDiagnostics object
+         *
+         * @param diagnostics Diagnostics to copy-construct from
+         */
+        HexDiagnostics(const HexDiagnostics& diagnostics) = default;
+
+        /**
+         * @brief Move-construct a new HexDiagnostics object
+         *
+         * @param diagnostics Diagnostics to move-construct from
+         */
+        HexDiagnostics(HexDiagnostics&& diagnostics) = default;
+
+        /**
+         * @brief Copy-assignment operator
+         *
+         * @param diagnostics Diagnostics to copy-assign
+         * @return HexDiagnostics& Assigned diagnostics
+         */
+        HexDiagnostics& operator=(const HexDiagnostics& diagnostics) = default;
+
+        /**
+         * @brief Move-assignment operator
+         *
+         * @param diagnostics Diagnostics to move-assign
+         * @return HexDiagnostics& Assigned diagnostics
+         */
+        HexDiagnostics& operator=(HexDiagnostics&& diagnostics) = default;
+
+        /**
+         * @brief Push an error
+         *
+         * @param error Error
+         * @note Errors past the maximum number of errors are counted, but not kept
+         * @return true Error was kept
+         * @return false Maximum number of errors is reached
+         */
+        bool pushError(const HexError& error);
+
+        /**
+         * @brief Get the kept errors
+         *
+         * @return const HexErrorVector& Errors in the order they were found
+         */
+        const HexErrorVector& getErrors() const;
+
+        /**
+         * @brief Get the number of all the pushed errors
+         *
+         * @return size_t Number of errors (including the errors which were not kept)
+         */
+        size_t getErrorCount() const;
+
+        /**
+         * @brief Get the maximum number of errors kept
+         *
+         * @return size_t Maximum number of errors
+         */
+        size_t getMaximumErrorCount() const;
+
+        /**
+         * @brief Check if the maximum number of errors is reached
+         *
+         * @return true No more errors can be kept
+         * @return false More errors can be kept
+         */
+        bool isFull() const;
+
+        /**
+         * @brief Check if any error was pushed
+         *
+         * @return true At least one error was pushed
+         * @return false No error was pushed
+         */
+        bool hasErrors() const;
+
+        /**
+         * @brief Remove all the errors
+         *
+         */
+        void clear();
+
+    protected:
+        /**
+         * @brief Kept errors
+         *
+         */
+        HexErrorVector errors;
+
+        /**
+         * @brief Number of all the pushed errors
+         *
+         */
+        size_t errorCount;
+
+        /**
+         * @brief Maximum number of errors kept
+         *
+         */
+        size_t maximumErrorCount;
+};
+
+/**
+ * @brief Shared pointer of HexDiagnostics
+ *
+ */
+typedef std::shared_ptr<HexDiagnostics> HexDiagnosticsPtr;
+
+/**
+ * @brief Unique pointer of HexDiagnostics
+ *
+ */
+typedef std::unique_ptr<HexDiagnostics> HexDiagnosticsUniquePtr;
+
+END_NAMESPACE_LIBIHEX
@@ -21,8 +21,16 @@
 
 #pragma once
 
+#include <cstddef>
+#include <istream>
 #include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <ihex/hex_diagnostics.hpp>
 #include <ihex/hex_group.hpp>
+#include <ihex/hex_sink.hpp>
 #include <ihex/version.hpp>
 
 BEGIN_NAMESPACE_LIBIHEX
@@ -40,6 +48,19 @@ class HexFile final : public HexGroup
          */
         HexFile();
 
+        /**
+         * @brief Construct a new HexFile object
+         *
+         * Sections and their data are allocated with the allocator, which allows
+         * loading the image into an arena (for example std::pmr::monotonic_buffer_resource)
+         * and releasing it at once. Sections parsed by the worker threads are
+         * built with the default memory resource and copied with the allocator,
+         * so the memory resource is only used by the calling thread.
+         *
+         * @param allocator Allocator of the sections and of their data
+         */
+        explicit HexFile(const allocator_type& allocator);
+
         /**
          * @brief Destroy the HexFile object
          *
@@ -82,6 +103,8 @@ class HexFile final : public HexGroup
          * @throw std::runtime_error Invalid record found (throws only if enableThrowOnInvalidRecord is set to true)
          * @throw std::logic_error Record checksum mismatch found (throws only if enableThrowOnChecksumMismatch is set to true)
          *
+         * @note Regular files are memory-mapped and parsed in place where supported
+         *
          * @param fileName File name
          * @return true Successfully loaded data from file
          * @return false Failed to load data from file
@@ -100,6 +123,108 @@ class HexFile final : public HexGroup
          */
         virtual bool load(std::istream& stream);
 
+        /**
+         * @brief Load data from memory
+         *
+         * @throw std::runtime_error Invalid record found (throws only if enableThrowOnInvalidRecord is set to true)
+         * @throw std::logic_error Record checksum mismatch found (throws only if enableThrowOnChecksumMismatch is set to true)
+         *
+         * @note Large inputs are parsed in parallel if thread count is not 1 (see setThreadCount),
+         *   the result is the same as with the sequential loading
+         *
+         * @param data Pointer to the records in text format (lines separated by HEX_RECORD_LINE_SEPARATOR)
+         * @param dataSize Size of the data
+         * @return true Successfully loaded data from memory
+         * @return false Failed to load data from memory
+         */
+        virtual bool load(const char* data, size_t dataSize);
+
+        /**
+         * @brief Load a single line of text
+         *
+         * @throw std::runtime_error Invalid record found (throws only if enableThrowOnInvalidRecord is set to true)
+         * @throw std::logic_error Record checksum mismatch found (throws only if enableThrowOnChecksumMismatch is set to true)
+         *
+         * @param line Line of text (empty lines are ignored)
+         * @note Line is assumed to be followed by a line separator in the input (see getLineNumber and getLineOffset)
+         * @return true Successfully loaded the line
+         * @return false Failed to load the line
+         */
+        virtual bool loadLine(std::string_view line);
+
+        /**
+         * @brief Load a single line of text
+         *
+         * @throw std::runtime_error Invalid record found (throws only if enableThrowOnInvalidRecord is set to true)
+         * @throw std::logic_error Record checksum mismatch found (throws only if enableThrowOnChecksumMismatch is set to true)
+         *
+         * @param line Line of text (empty lines are ignored)
+         * @param lineSize Size of the line in the input (including line separator)
+         * @return true Successfully loaded the line
+         * @return false Failed to load the line
+         */
+        virtual bool loadLine(std::string_view line, size_t lineSize);
+
+        /**
+         * @brief Get the number of the last loaded line
+         *
+         * @note Lines are numbered from 1, from the start of the last loaded file, stream or memory
+         * @return size_t Line number
+         */
+        virtual size_t getLineNumber();
+
+        /**
+         * @brief Get the offset of the last loaded line
+         *
+         * @return size_t Offset of the first character of the line from the start of the input
+         */
+        virtual size_t getLineOffset();
+
+        /**
+         * @brief Reset the line number and offset to the start of the input
+         *
+         * @note Loading a file, stream or memory resets the line position,
+         *   call this function before loading a new input line by line
+         */
+        virtual void resetLinePosition();
+
+        /**
+         * @brief Validate records of a file without loading them
+         *
+         * Checks the syntax and checksum of every record, no records or sections are created.
+         *
+         * @param fileName File name
+         * @param diagnostics Diagnostics to push the errors to (validation stops when it is full)
+         * @return true File was read and all the records are valid
+         * @return false Failed to read the file or found an invalid record
+         */
+        static bool validate(const std::string& fileName, HexDiagnostics& diagnostics);
+
+        /**
+         * @brief Validate records of a stream without loading them
+         *
+         * Checks the syntax and checksum of every record, no records or sections are created.
+         *
+         * @param stream Stream
+         * @param diagnostics Diagnostics to push the errors to (validation stops when it is full)
+         * @return true All the records are valid
+         * @return false Found an invalid record
+         */
+        static bool validate(std::istream& stream, HexDiagnostics& diagnostics);
+
+        /**
+         * @brief Validate records in memory without loading them
+         *
+         * Checks the syntax and checksum of every record, no records or sections are created.
+         *
+         * @param data Pointer to the records in text format (lines separated by HEX_RECORD_LINE_SEPARATOR)
+         * @param dataSize Size of the data
+         * @param diagnostics Diagnostics to push the errors to (validation stops when it is full)
+         * @return true All the records are valid
+         * @return false Found an invalid record
+         */
+        static bool validate(const char* data, size_t dataSize, HexDiagnostics& diagnostics);
+
         /**
          * @brief Save data to file
          *
@@ -112,12 +237,31 @@ class HexFile final : public HexGroup
         /**
          * @brief Save data to stream
          *
+         * @throw std::out_of_range Data block is too large for a single record
+         *
+         * @note Large groups are encoded in parallel if thread count is not 1 (see setThreadCount),
+         *   the output is the same as with the sequential saving
+         *
          * @param stream Stream
          * @return true Successfully saved data to stream
          * @return false Failed to save data to stream
          */
         virtual bool save(std::ostream& stream);
 
+        /**
+         * @brief Save data to sink
+         *
+         * @throw std::out_of_range Data block is too large for a single record
+         *
+         * @note Large groups are encoded in parallel if thread count is not 1 (see setThreadCount),
+         *   the output is the same as with the sequential saving
+         *
+         * @param sink Sink (flushed after the last record)
+         * @return true Successfully saved data to sink
+         * @return false Failed to save data to sink
+         */
+        virtual bool save(HexSink& sink);
+
         /**
          * @brief Get the option to throw on invalid record
          *
@@ -130,6 +274,7 @@ class HexFile final : public HexGroup
          * @brief Set the option to throw on invalid record
          *
          * @param enableThrowOnInvalidRecord Enable throwing on invalid record
+         * @note Option is ignored while diagnostics is set
          */
         virtual void setThrowOnInvalidRecord(bool enableThrowOnInvalidRecord);
 
@@ -145,9 +290,203 @@ class HexFile final : public HexGroup
          * @brief Set the option to throw on record checksum mismatch
          *
          * @param enableThrowOnChecksumMismatch Enable throwing on record checksum mismatch
+         * @note Option is ignored while diagnostics is set
          */
         virtual void setThrowOnChecksumMismatch(bool enableThrowOnChecksumMismatch);
+
+        /**
+         * @brief Get the number of threads used for loading and saving
+         *
+         * @return size_t Number of threads (0 uses all hardware threads)
+         */
+        virtual size_t getThreadCount();
+
+        /**
+         * @brief Set the number of threads used for loading and saving
+         *
+         * @param threadCount Number of threads (1 loads and saves sequentially, 0 uses all hardware threads)
+         * @note Only files and memory are loaded in parallel, streams are always loaded sequentially
+         */
+        virtual void setThreadCount(size_t threadCount);
+
+        /**
+         * @brief Get the line separator used for saving
+         *
+         * @return std::string Line separator
+         */
+        virtual std::string getLineSeparator();
+
+        /**
+         * @brief Set the line separator used for saving
+         *
+         * @param lineSeparator Line separator (for example "\r\n")
+         * @throw std::invalid_argument Line separator is empty
+         * @note Loading accepts both "\n" and "\r\n" line separators
+         */
+        virtual void setLineSeparator(const std::string& lineSeparator = std::string(1, HEX_RECORD_LINE_SEPARATOR));
+
+        /**
+         * @brief Get the maximum data size of the saved data records
+         *
+         * @return HexDataSizeType Maximum data size (0 saves a record per data block)
+         */
+        virtual HexDataSizeType getRecordDataSize();
+
+        /**
+         * @brief Set the maximum data size of the saved data records
+         *
+         * Data of the contiguous blocks is re-chunked into records of up to the
+         * record data size on save, without modifying the sections.
+         *
+         * @param recordDataSize Maximum data size (0 saves a record per data block)
+         * @throw std::out_of_range Record data size is greater than MAXIMUM_HEX_RECORD_DATA_SIZE
+         */
+        virtual void setRecordDataSize(HexDataSizeType recordDataSize = 0);
+
+        /**
+         * @brief Get the alignment of the saved data records
+         *
+         * @return HexDataSizeType Alignment (0 or 1 if records are not aligned)
+         */
+        virtual HexDataSizeType getRecordAlignment();
+
+        /**
+         * @brief Set the alignment of the saved data records
+         *
+         * @param recordAlignment Alignment of the relative record addresses (0 or 1 disables alignment)
+         * @note Alignment is used only while record data size is not 0 (see setRecordDataSize)
+         */
+        virtual void setRecordAlignment(HexDataSizeType recordAlignment = 0);
+
+        /**
+         * @brief Get the option to cache the encoded sections for saving
+         *
+         * @return true Encoded sections are cached
+         * @return false Encoded sections are not cached
+         */
+        virtual bool getSaveCache();
+
+        /**
+         * @brief Set the option to cache the encoded sections for saving
+         *
+         * While the option is set, the encoded text of every saved section is kept
+         * and reused by the following saves until the section is modified (see
+         * HexSection::getRevision), so only the modified sections are encoded again.
+         * Sections with the data referenced through the non-const operator[] are
+         * encoded on every save.
+         *
+         * @param enableSaveCache Enable caching of the encoded sections (disabling clears the cache)
+         */
+        virtual void setSaveCache(bool enableSaveCache);
+
+        /**
+         * @brief Clear the cache of the encoded sections
+         *
+         * @note Cache is cleared also by changing the record data size, the record alignment or the line separator
+         */
+        virtual void clearSaveCache();
+
+        /**
+         * @brief Get the size of the cache of the encoded sections
+         *
+         * @return size_t Size of the cached text
+         */
+        virtual size_t getSaveCacheSize();
+
+        /**
+         * @brief Get the diagnostics used for loading
+         *
+         * @return HexDiagnosticsPtr Diagnostics (nullptr if not set)
+         */
+        virtual HexDiagnosticsPtr getDiagnostics();
+
+        /**
+         * @brief Set the diagnostics used for loading
+         *
+         * While diagnostics is set, invalid records, records with checksum mismatch and
+         * records rejected by the sections are pushed to it and loading continues
+         * without throwing exceptions. Rejected records fail the loading only while
+         * diagnostics is set, otherwise they are silently ignored.
+         *
+         * @param diagnostics Diagnostics (nullptr restores throwing exceptions as set by the options)
+         */
+        virtual void setDiagnostics(HexDiagnosticsPtr diagnostics);
     protected:
+        /**
+         * @brief Report an error found at the current line
+         *
+         * @throw std::runtime_error Invalid record found (throws only if enableThrowOnInvalidRecord is set to true and diagnostics is not set)
+         * @throw std::logic_error Record checksum mismatch found (throws only if enableThrowOnChecksumMismatch is set to true and diagnostics is not set)
+         *
+         * @param errorType Type of the error
+         * @param line Line of text
+         * @return true Error does not fail the loading (ERROR_REJECTED_RECORD while diagnostics is not set)
+         * @return false Line failed to load
+         */
+        bool reportError(HexErrorType errorType, std::string_view line);
+
+        /**
+         * @brief Load lines of text sequentially
+         *
+         * @throw std::runtime_error Invalid record found (throws only if enableThrowOnInvalidRecord is set to true)
+         * @throw std::logic_error Record checksum mismatch found (throws only if enableThrowOnChecksumMismatch is set to true)
+         *
+         * @param data Pointer to the lines of text
+         * @param dataSize Size of the data
+         * @return true Successfully loaded all the lines
+         * @return false Failed to load some of the lines
+         */
+        bool loadLines(const char* data, size_t dataSize);
+
+        /**
+         * @brief Load lines of text in parallel
+         *
+         * Input is split into chunks, which start with a record opening a new section.
+         * Chunks are parsed into sections by worker threads and merged in order,
+         * following the rules of the sequential loading.
+         *
+         * @throw std::runtime_error Invalid record found (throws only if enableThrowOnInvalidRecord is set to true)
+         * @throw std::logic_error Record checksum mismatch found (throws only if enableThrowOnChecksumMismatch is set to true)
+         *
+         * @param data Pointer to the lines of text
+         * @param dataSize Size of the data
+         * @param threadCount Number of threads
+         * @return true Successfully loaded all the lines
+         * @return false Failed to load some of the lines
+         */
+        bool loadParallel(const char* data, size_t dataSize, size_t threadCount);
+
+        /**
+         * @brief Save data to sink in parallel
+         *
+         * Sections are split into chunks of about the same number of records, which
+         * are encoded by worker threads and written in order, so the output is the
+         * same as with the sequential saving.
+         *
+         * @throw std::out_of_range Data block is too large for a single record
+         *
+         * @param sink Sink
+         * @param threadCount Number of threads
+         * @return true Successfully saved data to sink
+         * @return false Failed to save data to sink
+         */
+        bool saveParallel(HexSink& sink, size_t threadCount);
+
+        /**
+         * @brief Save data to sink with the cache of the encoded sections
+         *
+         * Sections, which are not cached, are encoded by worker threads, each section by
+         * a single thread. Sections are written in order.
+         *
+         * @throw std::out_of_range Data block is too large for a single record
+         *
+         * @param sink Sink
+         * @param threadCount Number of threads
+         * @return true Successfully saved data to sink
+         * @return false Failed to save data to sink
+         */
+        bool saveCached(HexSink& sink, size_t threadCount);
+
         /**
          * @brief Enable throwing exception on invalid record
          *
@@ -159,6 +498,66 @@ class HexFile final : public HexGroup
          *
          */
         bool enableThrowOnChecksumMismatch;
+
+        /**
+         * @brief Number of threads used for loading and saving
+         *
+         */
+        size_t threadCount;
+
+        /**
+         * @brief Line separator used for saving
+         *
+         */
+        std::string lineSeparator;
+
+        /**
+         * @brief Maximum data size of the saved data records (0 saves a record per data block)
+         *
+         */
+        HexDataSizeType recordDataSize;
+
+        /**
+         * @brief Alignment of the saved data records
+         *
+         */
+        HexDataSizeType recordAlignment;
+
+        /**
+         * @brief Enable caching of the encoded sections for saving
+         *
+         */
+        bool enableSaveCache;
+
+        /**
+         * @brief Encoded text of the sections by their revision
+         *
+         */
+        std::unordered_map<uint64_t, std::string> saveCache;
+
+        /**
+         * @brief Diagnostics used for loading
+         *
+         */
+        HexDiagnosticsPtr diagnostics;
+
+        /**
+         * @brief Number of the last loaded line
+         *
+         */
+        size_t lineNumber;
+
+        /**
+         * @brief Offset of the last loaded line
+         *
+         */
+        size_t lineOffset;
+
+        /**
+         * @brief Offset of the next line
+         *
+         */
+        size_t nextLineOffset;
 };
 
 /**
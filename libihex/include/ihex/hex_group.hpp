@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory_resource>
 #include <vector>
 #include <ihex/hex_address.hpp>
 #include <ihex/hex_record.hpp>
@@ -32,16 +34,39 @@ BEGIN_NAMESPACE_LIBIHEX
 /**
  * @brief HexGroup class
  *
+ * Sections are looked up by the absolute address through a sorted table of the
+ * section address ranges, which also caches the group type. The table is kept up
+ * to date by the modifying functions. Sections handed out through the non-const
+ * references are checked on every lookup, and the const lookups use the current
+ * ranges without modifying the group if any of them changed the type or the
+ * address, until the next modification rebuilds the table.
+ *
  */
 class HexGroup
 {
     public:
+        /**
+         * @brief Allocator of the sections and of their data
+         *
+         */
+        typedef HexAllocator allocator_type;
+
         /**
          * @brief Construct a new HexGroup object
          *
          */
         explicit HexGroup();
 
+        /**
+         * @brief Construct a new HexGroup object
+         *
+         * All sections and their data are allocated with the allocator,
+         * copies of the group use the default memory resource.
+         *
+         * @param allocator Allocator of the sections and of their data
+         */
+        explicit HexGroup(const allocator_type& allocator);
+
         /**
          * @brief Destroy the HexGroup object
          *
@@ -53,14 +78,14 @@ class HexGroup
          *
          * @param group Group to copy-construct from
          */
-        HexGroup(const HexGroup& group) = default;
+        HexGroup(const HexGroup& group);
 
         /**
          * @brief Move-construct a new HexGroup object
          *
          * @param group Group to move-construct from
          */
-        HexGroup(HexGroup&& group) = default;
+        HexGroup(HexGroup&& group);
 
         /**
          * @brief Copy-assignment operator
@@ -68,7 +93,7 @@ class HexGroup
          * @param group Group to copy-assign
          * @return HexGroup& Assigned group
          */
-        HexGroup& operator=(const HexGroup& group) = default;
+        HexGroup& operator=(const HexGroup& group);
 
         /**
          * @brief Move-assignment operator
@@ -76,7 +101,14 @@ class HexGroup
          * @param group Group to move-assign
          * @return HexGroup& Assigned group
          */
-        HexGroup& operator=(HexGroup&& group) = default;
+        HexGroup& operator=(HexGroup&& group);
+
+        /**
+         * @brief Get the allocator of the sections and of their data
+         *
+         * @return allocator_type Allocator
+         */
+        allocator_type get_allocator() const;
 
         /**
          * @brief Array index operator
@@ -122,9 +154,17 @@ class HexGroup
          * @param index Section index
          * @throw std::out_of_range index is out of range
          * @return HexSection& Section
+         * @note Changes of the section type or address through the reference are detected by the following lookups
          */
         virtual HexSection& getSection(size_t index);
 
+        /**
+         * @brief Get the number of sections handed out through non-const references
+         *
+         * @return size_t Number of referenced sections, which the lookups check for changes
+         */
+        virtual size_t getReferencedSectionCount() const;
+
         /**
          * @brief Find section which contains the absolute address
          *
@@ -427,6 +467,24 @@ class HexGroup
          */
         virtual void setUnusedDataFillValue(HexDataType unusedDataFillValue = DEFAULT_HEX_RECORD_DATA_VALUE);
 
+        /**
+         * @brief Get the storage type of the sections
+         *
+         * @return HexSectionStorageType Storage type of the sections
+         */
+        virtual HexSectionStorageType getSectionStorageType() const;
+
+        /**
+         * @brief Set the storage type of the sections
+         *
+         * Storage type is applied to the existing sections and to every section
+         * pushed or created later (including the sections of the loaded files).
+         *
+         * @param sectionStorageType Storage type of the sections
+         * @throw std::invalid_argument Storage type is not valid
+         */
+        virtual void setSectionStorageType(HexSectionStorageType sectionStorageType = HexSectionStorageType::STORAGE_BLOCKS);
+
         /**
          * @brief Check if group can have SECTION_START_SEGMENT_ADDRESS section
          *
@@ -559,6 +617,165 @@ class HexGroup
          */
         virtual size_t getSectionDefaultPushIndex(const HexSection& section) const;
 
+        /**
+         * @brief Address range of a section with addresses
+         *
+         */
+        struct HexAddressRange
+        {
+            /**
+             * @brief Starting absolute address of the range
+             *
+             */
+            HexAddressType address;
+
+            /**
+             * @brief Size of the range
+             *
+             */
+            HexDataSizeType size;
+
+            /**
+             * @brief Index of the section with the range
+             *
+             */
+            size_t index;
+
+            /**
+             * @brief Less-than operator (by the starting absolute address)
+             *
+             * @param range Range to compare to
+             * @return true Range starts before the other range
+             * @return false Range does not start before the other range
+             */
+            bool operator<(const HexAddressRange& range) const;
+        };
+
+        /**
+         * @brief Address ranges sorted by the starting absolute address
+         *
+         */
+        typedef std::pmr::vector<HexAddressRange> HexAddressRangeVector;
+
+        /**
+         * @brief State of a section handed out through a non-const reference
+         *
+         */
+        struct HexSectionReference
+        {
+            /**
+             * @brief Index of the section
+             *
+             */
+            size_t index;
+
+            /**
+             * @brief Type of the section at the last update of the address ranges
+             *
+             */
+            HexSectionType type;
+
+            /**
+             * @brief Extended address of the section at the last update of the address ranges
+             *
+             */
+            uint16_t extendedAddress;
+        };
+
+        /**
+         * @brief States of the sections handed out through non-const references
+         *
+         */
+        typedef std::pmr::vector<HexSectionReference> HexSectionReferenceVector;
+
+        /**
+         * @brief Get the section for changing it through the reference
+         *
+         * @param index Section index
+         * @throw std::out_of_range index is out of range
+         * @return HexSection& Section
+         */
+        HexSection& referenceSection(size_t index);
+
+        /**
+         * @brief Forget the references to the sections at and after the index
+         *
+         * @param index Section index
+         * @note References to these sections are invalidated by inserting or erasing a section at the index
+         */
+        void dropSectionReferences(size_t index);
+
+        /**
+         * @brief Erase the section
+         *
+         * @param it Section to erase
+         * @return HexSectionVector::iterator Section following the erased one
+         * @note Address ranges have to be updated by the caller
+         */
+        HexSectionVector::iterator eraseSection(HexSectionVector::const_iterator it);
+
+        /**
+         * @brief Get the current state of the section
+         *
+         * @param index Section index
+         * @return HexSectionReference State of the section
+         */
+        HexSectionReference makeSectionReference(size_t index) const;
+
+        /**
+         * @brief Check if the address ranges and the group type are up to date
+         *
+         * @return true None of the referenced sections changed its type or address
+         * @return false Address ranges have to be rebuilt
+         */
+        bool hasValidAddressRanges() const;
+
+        /**
+         * @brief Rebuild the address ranges and the group type if they are not up to date
+         *
+         */
+        void updateAddressRanges();
+
+        /**
+         * @brief Rebuild the address ranges and the group type
+         *
+         */
+        void rebuildAddressRanges();
+
+        /**
+         * @brief Append the address ranges of the section
+         *
+         * @param ranges Address ranges to append to
+         * @param index Section index
+         * @note Wrapped-around SECTION_EXTENDED_SEGMENT_ADDRESS section has two ranges
+         */
+        void appendAddressRanges(HexAddressRangeVector& ranges, size_t index) const;
+
+        /**
+         * @brief Get the current address ranges
+         *
+         * @param ranges Storage for the ranges collected from the sections if the address ranges are not up to date
+         * @return const HexAddressRangeVector& Address ranges of the group or the collected ranges
+         */
+        const HexAddressRangeVector& getAddressRanges(HexAddressRangeVector& ranges) const;
+
+        /**
+         * @brief Find the address range containing the absolute address
+         *
+         * @param ranges Address ranges
+         * @param address Absolute address
+         * @return HexAddressRangeVector::const_iterator Range containing the absolute address,
+         *   or the first range after the absolute address if no range contains it
+         */
+        HexAddressRangeVector::const_iterator findAddressRange(const HexAddressRangeVector& ranges, HexAddressType address) const;
+
+        /**
+         * @brief Find the group type from the types of the sections
+         *
+         * @return HexAddressEnumType Group type
+         */
+        HexAddressEnumType findGroupType() const;
+
         /**
          * @brief Hex sections
          *
@@ -570,6 +787,43 @@ class HexGroup
          *
          */
         HexDataType unusedDataFillValue;
+
+        /**
+         * @brief Storage type of the sections
+         *
+         */
+        HexSectionStorageType sectionStorageType;
+
+        /**
+         * @brief Address ranges of the sections with addresses
+         *
+         */
+        HexAddressRangeVector addressRanges;
+
+        /**
+         * @brief Group type of the sections
+         *
+         */
+        HexAddressEnumType groupType;
+
+        /**
+         * @brief Sections handed out through non-const references
+         *
+         */
+        HexSectionReferenceVector sectionReferences;
+
+        /**
+         * @brief Flags of the sections in the section references by the section index
+         *
+         */
+        std::pmr::vector<bool> referencedSections;
+
+        /**
+         * @brief Position of the last found range in the address ranges
+         *
+         * @note Atomic so that concurrent const lookups of the group remain safe
+         */
+        mutable std::atomic<size_t> addressCursor;
 };
 
 /**
@@ -0,0 +1,224 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <memory>
+#include <ihex/hex_address.hpp>
+#include <ihex/hex_record.hpp>
+#include <ihex/hex_visitor.hpp>
+#include <ihex/version.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief HexImage class
+ *
+ * Flat memory image, which the visited data records are written to directly,
+ * without building any sections. Unwritten data is set to the fill value.
+ *
+ * The image either owns a vector, which grows to cover the addresses from the
+ * lowest to the highest written address, or writes to a fixed caller buffer,
+ * where data outside of the buffer is discarded. The owned vector grows
+ * geometrically in both directions, so data visited in the descending address
+ * order is written in amortized constant time per byte.
+ *
+ */
+class HexImage final : public HexVisitor
+{
+    public:
+        /**
+         * @brief Construct a new HexImage object with an owned vector
+         *
+         * @param fillValue Value of the unwritten data
+         * @note Vector covers all the addresses between the lowest and the highest written address
+         */
+        explicit HexImage(HexDataType fillValue = DEFAULT_HEX_RECORD_DATA_VALUE);
+
+        /**
+         * @brief Construct a new HexImage object with a caller buffer
+         *
+         * @param baseAddress Absolute address of the first byte of the buffer
+         * @param data Pointer to the buffer (filled with the fill value)
+         * @param dataSize Size of the buffer
+         * @param fillValue Value of the unwritten data
+         * @note Buffer must outlive the image
+         */
+        explicit HexImage(HexAddressType baseAddress, HexDataType* data, HexDataSizeType dataSize, HexDataType fillValue = DEFAULT_HEX_RECORD_DATA_VALUE);
+
+        /**
+         * @brief Copy-construct a new HexImage object
+         *
+         * @param image Image to copy-construct from
+         */
+        HexImage(const HexImage& image) = default;
+
+        /**
+         * @brief Move-construct a new HexImage object
+         *
+         * @param image Image to move-construct from
+         */
+        HexImage(HexImage&& image) = default;
+
+        /**
+         * @brief Get the address of the first byte of the image
+         *
+         * @return HexAddressType Base address (lowest written address for an owned vector)
+         */
+        HexAddressType getBaseAddress() const;
+
+        /**
+         * @brief Get the pointer to the image data
+         *
+         * @return const HexDataType* Pointer to the data
+         */
+        const HexDataType* getData() const;
+
+        /**
+         * @brief Get the size of the image data
+         *
+         * @return HexDataSizeType Size of the data
+         */
+        HexDataSizeType getSize() const;
+
+        /**
+         * @brief Move the owned vector out of the image and clear it
+         *
+         * @return HexDataVector Owned vector (empty for a caller buffer, which is not cleared)
+         */
+        HexDataVector releaseDataVector();
+
+        /**
+         * @brief Get the value of the unwritten data
+         *
+         * @return HexDataType Fill value
+         */
+        HexDataType getFillValue() const;
+
+        /**
+         * @brief Get the written address ranges
+         *
+         * @return const HexAddressMap& Written address ranges (adjacent ranges are merged)
+         */
+        const HexAddressMap& getWrittenMap() const;
+
+        /**
+         * @brief Get the size of the data discarded for being outside of the caller buffer
+         *
+         * @return HexDataSizeType Size of the discarded data
+         */
+        HexDataSizeType getDiscardedSize() const;
+
+        /**
+         * @brief Check if the image uses a caller buffer
+         *
+         * @return true Image writes to a caller buffer
+         * @return false Image owns a vector
+         */
+        bool isExternal() const;
+
+        /**
+         * @brief Clear the written data and reset the visitor
+         *
+         * @note Owned vector is emptied, caller buffer is filled with the fill value
+         */
+        void clear();
+
+    protected:
+        /**
+         * @brief Write the data run to the image
+         *
+         * @param address Absolute address of the first byte
+         * @param data Pointer to the data
+         * @param dataSize Size of the data
+         */
+        virtual void onData(HexAddressType address, const HexDataType* data, HexDataSizeType dataSize) override;
+
+        /**
+         * @brief Add the range to the written address ranges
+         *
+         * @param address Absolute address of the first byte
+         * @param size Size of the range
+         */
+        void pushWrittenRange(HexAddressType address, HexDataSizeType size);
+
+        /**
+         * @brief Address of the first byte of the image
+         *
+         */
+        HexAddressType baseAddress;
+
+        /**
+         * @brief Owned vector (the image starts after the headroom)
+         *
+         */
+        HexDataVector vector;
+
+        /**
+         * @brief Size of the headroom in front of the image in the owned vector (filled with the fill value)
+         *
+         */
+        HexDataSizeType frontSize;
+
+        /**
+         * @brief Caller buffer (nullptr for an owned vector)
+         *
+         */
+        HexDataType* buffer;
+
+        /**
+         * @brief Size of the caller buffer
+         *
+         */
+        HexDataSizeType bufferSize;
+
+        /**
+         * @brief Value of the unwritten data
+         *
+         */
+        HexDataType fillValue;
+
+        /**
+         * @brief Written address ranges
+         *
+         */
+        HexAddressMap writtenMap;
+
+        /**
+         * @brief Size of the discarded data
+         *
+         */
+        HexDataSizeType discardedSize;
+};
+
+/**
+ * @brief Shared pointer of HexImage
+ *
+ */
+typedef std::shared_ptr<HexImage> HexImagePtr;
+
+/**
+ * @brief Unique pointer of HexImage
+ *
+ */
+typedef std::unique_ptr<HexImage> HexImageUniquePtr;
+
+END_NAMESPACE_LIBIHEX
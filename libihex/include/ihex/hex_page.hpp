@@ -0,0 +1,275 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+#include <ihex/hex_record.hpp>
+#include <ihex/version.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief Size of the page (whole relative address space of a section)
+ *
+ */
+static constexpr HexDataSizeType HEX_PAGE_SIZE{MAXIMUM_HEX_RECORD_ADDRESS + 1};
+
+/**
+ * @brief HexPage class
+ *
+ * Flat storage of the relative address space of a section. Data is kept in a
+ * single contiguous buffer with an occupancy bitmap, both allocated on the
+ * first write, which gives constant time access to individual addresses and
+ * memcpy speed access to address ranges.
+ *
+ */
+class HexPage final
+{
+    public:
+        /**
+         * @brief Allocator of the page buffers
+         *
+         */
+        typedef HexAllocator allocator_type;
+
+        /**
+         * @brief Construct a new empty HexPage object
+         *
+         */
+        explicit HexPage();
+
+        /**
+         * @brief Construct a new empty HexPage object
+         *
+         * @param allocator Allocator of the page buffers
+         */
+        explicit HexPage(const allocator_type& allocator);
+
+        /**
+         * @brief Copy-construct a new HexPage object
+         *
+         * @param page Page to copy-construct from
+         */
+        HexPage(const HexPage& page) = default;
+
+        /**
+         * @brief Copy-construct a new HexPage object with the allocator
+         *
+         * @param page Page to copy-construct from
+         * @param allocator Allocator of the page buffers
+         */
+        HexPage(const HexPage& page, const allocator_type& allocator);
+
+        /**
+         * @brief Move-construct a new HexPage object
+         *
+         * @param page Page to move-construct from
+         */
+        HexPage(HexPage&& page) = default;
+
+        /**
+         * @brief Move-construct a new HexPage object with the allocator
+         *
+         * @param page Page to move-construct from
+         * @param allocator Allocator of the page buffers
+         */
+        HexPage(HexPage&& page, const allocator_type& allocator);
+
+        /**
+         * @brief Copy-assignment operator
+         *
+         * @param page Page to copy-assign
+         * @return HexPage& Assigned page
+         */
+        HexPage& operator=(const HexPage& page) = default;
+
+        /**
+         * @brief Move-assignment operator
+         *
+         * @param page Page to move-assign
+         * @return HexPage& Assigned page
+         */
+        HexPage& operator=(HexPage&& page) = default;
+
+        /**
+         * @brief Get the allocator of the page buffers
+         *
+         * @return allocator_type Allocator
+         */
+        allocator_type get_allocator() const;
+
+        /**
+         * @brief Check if the page has any data
+         *
+         * @return true Page has data
+         * @return false Page is empty
+         */
+        bool hasData() const;
+
+        /**
+         * @brief Check if the page has data at an address
+         *
+         * @param address Relative address
+         * @return true Address has data
+         * @return false Address has no data
+         */
+        bool hasData(HexDataAddressType address) const;
+
+        /**
+         * @brief Get the number of the addresses with data
+         *
+         * @return HexDataSizeType Number of the addresses with data
+         */
+        HexDataSizeType getDataSize() const;
+
+        /**
+         * @brief Get the buffer of the page
+         *
+         * @note Content of the addresses without data is undefined
+         * @return const HexDataType* Buffer of HEX_PAGE_SIZE bytes (nullptr if the page was never written)
+         */
+        const HexDataType* getData() const;
+
+        /**
+         * @brief Get the buffer of the page
+         *
+         * @note Content of the addresses without data is undefined
+         * @return HexDataType* Buffer of HEX_PAGE_SIZE bytes (nullptr if the page was never written)
+         */
+        HexDataType* getData();
+
+        /**
+         * @brief Get data
+         *
+         * @param address Relative address of the data
+         * @param data Pointer to the data to copy to
+         * @param dataSize Size of the data (address range must not exceed the page)
+         * @param unusedDataFillValue Value of the addresses without data
+         */
+        void getData(HexDataAddressType address, HexDataType* data, HexDataSizeType dataSize, HexDataType unusedDataFillValue) const;
+
+        /**
+         * @brief Set data
+         *
+         * @param address Relative address of the data
+         * @param data Pointer to the data to copy from
+         * @param dataSize Size of the data (address range must not exceed the page)
+         */
+        void setData(HexDataAddressType address, const HexDataType* data, HexDataSizeType dataSize);
+
+        /**
+         * @brief Fill data
+         *
+         * @param address Relative address of the data
+         * @param dataSize Size of the data (address range must not exceed the page)
+         * @param data Value to fill the data with
+         */
+        void fillData(HexDataAddressType address, HexDataSizeType dataSize, HexDataType data);
+
+        /**
+         * @brief Clear all data and release the buffers
+         *
+         */
+        void clearData();
+
+        /**
+         * @brief Clear data
+         *
+         * @param address Relative address of the data
+         * @param dataSize Size of the data (address range must not exceed the page)
+         */
+        void clearData(HexDataAddressType address, HexDataSizeType dataSize);
+
+        /**
+         * @brief Find the first address with data
+         *
+         * @param address Address to search from
+         * @return HexDataSizeType First address with data at or after the address (HEX_PAGE_SIZE if there is none)
+         */
+        HexDataSizeType findData(HexDataSizeType address) const;
+
+        /**
+         * @brief Find the first address without data
+         *
+         * @param address Address to search from
+         * @return HexDataSizeType First address without data at or after the address (HEX_PAGE_SIZE if there is none)
+         */
+        HexDataSizeType findGap(HexDataSizeType address) const;
+
+        /**
+         * @brief Find the last address with data
+         *
+         * @return HexDataSizeType Last address with data (HEX_PAGE_SIZE if there is none)
+         */
+        HexDataSizeType findLastData() const;
+    protected:
+        /**
+         * @brief Allocate the buffers of the page
+         *
+         */
+        void allocate();
+
+        /**
+         * @brief Mark the addresses with data
+         *
+         * @param address Relative address of the data
+         * @param dataSize Size of the data
+         * @param used Addresses have data
+         */
+        void markData(HexDataSizeType address, HexDataSizeType dataSize, bool used);
+
+        /**
+         * @brief Data of the page
+         *
+         */
+        std::pmr::vector<HexDataType> data;
+
+        /**
+         * @brief Occupancy bitmap of the page (bit per address)
+         *
+         */
+        std::pmr::vector<uint64_t> bitmap;
+
+        /**
+         * @brief Number of the addresses with data
+         *
+         */
+        HexDataSizeType dataSize;
+};
+
+/**
+ * @brief Shared pointer of HexPage
+ *
+ */
+typedef std::shared_ptr<HexPage> HexPagePtr;
+
+/**
+ * @brief Unique pointer of HexPage
+ *
+ */
+typedef std::unique_ptr<HexPage> HexPageUniquePtr;
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,135 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <ihex/hex_file.hpp>
+#include <ihex/version.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief HexParser class
+ *
+ * Incremental parser, which loads records into a file as soon as their lines
+ * are complete. Input can be fed in chunks of any size, records split between
+ * the chunks are carried over to the next chunk.
+ *
+ */
+class HexParser final
+{
+    public:
+        /**
+         * @brief Construct a new HexParser object
+         *
+         * @param file File to load the records to
+         * @note File must outlive the parser, its exception options and diagnostics apply to the parser
+         * @note Line position of the file is reset to the start of the input
+         */
+        explicit HexParser(HexFile& file);
+
+        /**
+         * @brief Copy-construct a new HexParser object
+         *
+         * @param parser Parser to copy-construct from
+         */
+        HexParser(const HexParser& parser) = default;
+
+        /**
+         * @brief Move-construct a new HexParser object
+         *
+         * @param parser Parser to move-construct from
+         */
+        HexParser(HexParser&& parser) = default;
+
+        /**
+         * @brief Feed a chunk of input
+         *
+         * @throw std::runtime_error Invalid record found (throws only if file throws on invalid record)
+         * @throw std::logic_error Record checksum mismatch found (throws only if file throws on checksum mismatch)
+         *
+         * @param data Pointer to the chunk
+         * @param dataSize Size of the chunk
+         * @return true Successfully loaded all the lines completed by the chunk
+         * @return false Failed to load some of the lines completed by the chunk
+         */
+        bool feed(const char* data, size_t dataSize);
+
+        /**
+         * @brief Finish the input and load the last line (if it is not terminated)
+         *
+         * @throw std::runtime_error Invalid record found (throws only if file throws on invalid record)
+         * @throw std::logic_error Record checksum mismatch found (throws only if file throws on checksum mismatch)
+         *
+         * @note Parser can be fed with a new input after the call to this function
+         * @return true Successfully loaded the last line
+         * @return false Failed to load the last line
+         */
+        bool finish();
+
+        /**
+         * @brief Discard the incomplete line and reset the line position of the file to the start of the input
+         *
+         */
+        void reset();
+
+        /**
+         * @brief Get the size of the incomplete line carried over to the next chunk
+         *
+         * @return size_t Size of the incomplete line
+         */
+        size_t getPendingSize() const;
+    protected:
+        /**
+         * @brief File to load the records to
+         *
+         */
+        HexFile& file;
+
+        /**
+         * @brief Incomplete line carried over from the previous chunks
+         *
+         */
+        std::string pending;
+
+        /**
+         * @brief Size of the incomplete line in the input (before truncation)
+         *
+         */
+        size_t pendingLineSize;
+};
+
+/**
+ * @brief Shared pointer of HexParser
+ *
+ */
+typedef std::shared_ptr<HexParser> HexParserPtr;
+
+/**
+ * @brief Unique pointer of HexParser
+ *
+ */
+typedef std::unique_ptr<HexParser> HexParserUniquePtr;
+
+END_NAMESPACE_LIBIHEX
@@ -25,7 +25,9 @@
 #include <climits>
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <ihex/version.hpp>
 
@@ -73,6 +75,12 @@ static constexpr HexDataSizeType DEFAULT_HEX_RECORD_DATA_SIZE{0x10};
  */
 static constexpr HexDataType DEFAULT_HEX_RECORD_DATA_VALUE{std::numeric_limits<HexDataType>::max()};
 
+/**
+ * @brief Maximum length of the hex record text (start character, size, address, type, data and checksum)
+ *
+ */
+static constexpr HexDataSizeType MAXIMUM_HEX_RECORD_LENGTH{1 + (2 * (1 + 2 + 1 + MAXIMUM_HEX_RECORD_DATA_SIZE + 1))};
+
 /**
  * @brief Start of the hex record character
  *
@@ -145,6 +153,16 @@ struct HexDataArray : std::array<HexDataType, T>{};
  */
 typedef std::vector<HexDataType> HexDataVector;
 
+/**
+ * @brief Polymorphic allocator of the section and group containers
+ *
+ * Allocator-aware classes use it as their allocator_type, so the memory of the
+ * whole image can be provided by a single std::pmr::memory_resource.
+ */
+typedef std::pmr::polymorphic_allocator<HexDataType> HexAllocator;
+
+class HexRecordView;
+
 /**
  * @brief HexRecord class
  *
@@ -409,6 +427,39 @@ class HexRecord final
          */
         std::string getRecord() const;
 
+        /**
+         * @brief Get the length of the current record text
+         *
+         * @return HexDataSizeType Length of the record text (at most MAXIMUM_HEX_RECORD_LENGTH)
+         */
+        HexDataSizeType getRecordLength() const;
+
+        /**
+         * @brief Encode current record to a caller buffer
+         *
+         * @param record Pointer to the buffer of at least getRecordLength() characters
+         * @note Neither line separator nor null terminator is written
+         * @return HexDataSizeType Number of characters written
+         */
+        HexDataSizeType encode(char* record) const;
+
+        /**
+         * @brief Encode current record to the end of a string
+         *
+         * @param record String to append the record to (reuse it to avoid allocations)
+         * @note Line separator is not appended
+         * @return HexDataSizeType Number of characters appended
+         */
+        HexDataSizeType encode(std::string& record) const;
+
+        /**
+         * @brief Get the view of the current record
+         *
+         * @note View refers to the record data and is valid until the record is modified or destroyed
+         * @return HexRecordView View of the record
+         */
+        HexRecordView getView() const;
+
         /**
          * @brief Set new record and parse it
          *
@@ -420,7 +471,22 @@ class HexRecord final
          * @return true Record successfully parsed
          * @return false Record failed to parse successfully
          */
-        bool setRecord(const std::string& record);
+        bool setRecord(std::string_view record);
+
+        /**
+         * @brief Set new record and parse it
+         *
+         * @warning This function does not perform record checksum validation,
+         *   to assert checksum validity as well, use isValidChecksum function
+         *   after the call to this function.
+         *
+         * @param record Pointer to the new record characters
+         * @param recordSize Number of the record characters
+         * @note Characters following the checksum of the record are ignored
+         * @return true Record successfully parsed
+         * @return false Record failed to parse successfully (including non-hex digits)
+         */
+        bool setRecord(const char* record, HexDataSizeType recordSize);
 
         /**
          * @brief Get data size
@@ -495,6 +561,13 @@ class HexRecord final
          */
         bool setRecordType(HexRecordType recordType);
 
+        /**
+         * @brief Get data
+         *
+         * @return const HexDataType* Pointer to the data of the record (getDataSize() items)
+         */
+        const HexDataType* getData() const;
+
         /**
          * @brief Get data
          *
@@ -611,6 +684,19 @@ class HexRecord final
          */
         bool isValidRecord(HexRecordType recordType) const;
 
+        /**
+         * @brief Check validity of a record with the provided fields
+         *
+         * @warning This function does not perform record checksum validation.
+         *
+         * @param recordType Record type
+         * @param dataSize Size of the record data
+         * @param address Record address
+         * @return true Record would be valid
+         * @return false Record would not be valid
+         */
+        static bool isValidRecord(HexRecordType recordType, HexDataSizeType dataSize, HexDataAddressType address);
+
         /**
          * @brief Get the extended segment address
          *
@@ -709,10 +795,16 @@ class HexRecord final
         HexRecordType recordType;
 
         /**
-         * @brief Data of the record
+         * @brief Data of the record (inline storage, no allocations)
          *
          */
-        HexDataVector data;
+        HexDataArray<> data;
+
+        /**
+         * @brief Size of the data of the record
+         *
+         */
+        HexDataSizeType dataSize;
 
         /**
          * @brief Checksum of the record
@@ -733,4 +825,162 @@ typedef std::shared_ptr<HexRecord> HexRecordPtr;
  */
 typedef std::unique_ptr<HexRecord> HexRecordUniquePtr;
 
+/**
+ * @brief HexRecordView class
+ *
+ * Read-only view of a record, which refers to data owned by someone else
+ * (a HexRecord or a block of a HexSection) instead of copying it.
+ *
+ */
+class HexRecordView final
+{
+    public:
+        /**
+         * @brief Construct a new HexRecordView object of an end of file record
+         *
+         */
+        explicit HexRecordView();
+
+        /**
+         * @brief Construct a new HexRecordView object with a calculated checksum
+         *
+         * @param address Address of the record
+         * @param recordType Type of the record
+         * @param data Pointer to the data of the record
+         * @param dataSize Size of the data of the record
+         * @throw std::out_of_range Data size is out of range
+         */
+        explicit HexRecordView(HexDataAddressType address, HexRecordType recordType, const HexDataType* data, HexDataSizeType dataSize);
+
+        /**
+         * @brief Construct a new HexRecordView object
+         *
+         * @param address Address of the record
+         * @param recordType Type of the record
+         * @param data Pointer to the data of the record
+         * @param dataSize Size of the data of the record
+         * @param checksum Checksum of the record
+         * @throw std::out_of_range Data size is out of range
+         */
+        explicit HexRecordView(HexDataAddressType address, HexRecordType recordType, const HexDataType* data, HexDataSizeType dataSize, HexDataType checksum);
+
+        /**
+         * @brief Get the address of the record
+         *
+         * @return HexDataAddressType Address of the record
+         */
+        HexDataAddressType getAddress() const;
+
+        /**
+         * @brief Get the type of the record
+         *
+         * @return HexRecordType Type of the record
+         */
+        HexRecordType getRecordType() const;
+
+        /**
+         * @brief Get the data of the record
+         *
+         * @return const HexDataType* Pointer to the data of the record
+         */
+        const HexDataType* getData() const;
+
+        /**
+         * @brief Get the data item of the record
+         *
+         * @param index Index of the data item
+         * @throw std::out_of_range index out of range
+         * @return HexDataType Data item
+         */
+        HexDataType getData(HexDataSizeType index) const;
+
+        /**
+         * @brief Get the size of the data of the record
+         *
+         * @return HexDataSizeType Size of the data
+         */
+        HexDataSizeType getDataSize() const;
+
+        /**
+         * @brief Get the checksum of the record
+         *
+         * @return HexDataType Checksum of the record
+         */
+        HexDataType getChecksum() const;
+
+        /**
+         * @brief Get the length of the record text
+         *
+         * @return HexDataSizeType Length of the record text (at most MAXIMUM_HEX_RECORD_LENGTH)
+         */
+        HexDataSizeType getRecordLength() const;
+
+        /**
+         * @brief Get the record text
+         *
+         * @return std::string Record text
+         */
+        std::string getRecord() const;
+
+        /**
+         * @brief Encode the record to a caller buffer
+         *
+         * @param record Pointer to the buffer of at least getRecordLength() characters
+         * @note Neither line separator nor null terminator is written
+         * @return HexDataSizeType Number of characters written
+         */
+        HexDataSizeType encode(char* record) const;
+
+        /**
+         * @brief Encode the record to the end of a string
+         *
+         * @param record String to append the record to (reuse it to avoid allocations)
+         * @note Line separator is not appended
+         * @return HexDataSizeType Number of characters appended
+         */
+        HexDataSizeType encode(std::string& record) const;
+    protected:
+        /**
+         * @brief Address offset
+         *
+         */
+        HexDataAddressType address;
+
+        /**
+         * @brief Record type of type HexRecordType
+         *
+         */
+        HexRecordType recordType;
+
+        /**
+         * @brief Pointer to the data of the record
+         *
+         */
+        const HexDataType* data;
+
+        /**
+         * @brief Size of the data of the record
+         *
+         */
+        HexDataSizeType dataSize;
+
+        /**
+         * @brief Checksum of the record
+         *
+         */
+        HexDataType checksum;
+};
+
+/**
+ * @brief Shared pointer of HexRecordView
+ *
+ */
+typedef std::shared_ptr<HexRecordView> HexRecordViewPtr;
+
+/**
+ * @brief Unique pointer of HexRecordView
+ *
+ */
+typedef std::unique_ptr<HexRecordView> HexRecordViewUniquePtr;
+
 END_NAMESPACE_LIBIHEX
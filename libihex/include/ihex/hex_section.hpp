@@ -21,8 +21,17 @@
 
 #pragma once
 
-#include <map>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <utility>
+#include <vector>
 #include <ihex/hex_address.hpp>
+#include <ihex/hex_page.hpp>
 #include <ihex/hex_record.hpp>
 #include <ihex/version.hpp>
 
@@ -74,19 +83,62 @@ enum class HexSectionType : HexDataType
     SECTION_MAX = SECTION_START_LINEAR_ADDRESS
 };
 
+/**
+ * @brief Hex section storage types
+ *
+ */
+enum class HexSectionStorageType : HexDataType
+{
+    /**
+     * @brief Sorted vector of the data blocks (keeps the layout of the pushed records)
+     *
+     */
+    STORAGE_BLOCKS = 0,
+
+    /**
+     * @brief Flat page of the whole relative address space with an occupancy bitmap
+     *
+     * @note Records are made of the contiguous data, split to the default data size
+     */
+    STORAGE_PAGE = 1,
+
+    STORAGE_MIN = STORAGE_BLOCKS,
+    STORAGE_MAX = STORAGE_PAGE
+};
+
+class HexRecordIterator;
+
 /**
  * @brief HexSection class
  *
+ * Copies of a section (with the same allocator) share the data, which is
+ * copied only when one of them modifies it (copy-on-write). Once the data is
+ * referenced through the non-const operator[], the section copies it for
+ * every following copy.
+ *
  */
 class HexSection final
 {
     public:
+        /**
+         * @brief Allocator of the data blocks and of the data page
+         *
+         */
+        typedef HexAllocator allocator_type;
+
         /**
          * @brief Construct a new HexSection object
          *
          */
         explicit HexSection();
 
+        /**
+         * @brief Construct a new HexSection object
+         *
+         * @param allocator Allocator of the data
+         */
+        explicit HexSection(const allocator_type& allocator);
+
         /**
          * @brief Construct a new HexSection object
          *
@@ -111,6 +163,14 @@ class HexSection final
          */
         explicit HexSection(HexSectionType sectionType);
 
+        /**
+         * @brief Construct a new Hex Section object
+         *
+         * @param sectionType Section type
+         * @param allocator Allocator of the data
+         */
+        HexSection(HexSectionType sectionType, const allocator_type& allocator);
+
         /**
          * @brief Copy-construct a new HexSection object
          *
@@ -118,12 +178,28 @@ class HexSection final
          */
         HexSection(const HexSection& section);
 
+        /**
+         * @brief Copy-construct a new HexSection object with the allocator
+         *
+         * @param section Section to copy-construct from
+         * @param allocator Allocator of the data
+         */
+        HexSection(const HexSection& section, const allocator_type& allocator);
+
         /**
          * @brief Move-construct a new HexSection object
          *
          * @param section Section to move-construct from
          */
-        HexSection(HexSection&& section) = default;
+        HexSection(HexSection&& section) noexcept;
+
+        /**
+         * @brief Move-construct a new HexSection object with the allocator
+         *
+         * @param section Section to move-construct from
+         * @param allocator Allocator of the data (data is copied if it differs from the one of the section)
+         */
+        HexSection(HexSection&& section, const allocator_type& allocator);
 
         /**
          * @brief Copy-assignment operator
@@ -131,7 +207,7 @@ class HexSection final
          * @param section Section to copy-assign
          * @return HexSection& Assigned section
          */
-        HexSection& operator=(const HexSection& section) = default;
+        HexSection& operator=(const HexSection& section);
 
         /**
          * @brief Move-assignment operator
@@ -139,7 +215,14 @@ class HexSection final
          * @param section Section to move-assign
          * @return HexSection& Assigned section
          */
-        HexSection& operator=(HexSection&& section) = default;
+        HexSection& operator=(HexSection&& section);
+
+        /**
+         * @brief Get the allocator of the data
+         *
+         * @return allocator_type Allocator
+         */
+        allocator_type get_allocator() const;
 
         /**
          * @brief Array index operator
@@ -517,6 +600,25 @@ class HexSection final
          */
         void setDefaultDataSize(HexDataSizeType defaultDataSize = DEFAULT_HEX_RECORD_DATA_SIZE);
 
+        /**
+         * @brief Get the storage type of the data
+         *
+         * @return HexSectionStorageType Storage type
+         */
+        HexSectionStorageType getStorageType() const;
+
+        /**
+         * @brief Set the storage type of the data
+         *
+         * Data is moved to the new storage. Page storage does not keep the layout of
+         * the data blocks, records are made of the contiguous data split to the default
+         * data size (the same layout as compact() makes in the block storage).
+         *
+         * @param storageType Storage type
+         * @throw std::invalid_argument Storage type is not valid
+         */
+        void setStorageType(HexSectionStorageType storageType);
+
         /**
          * @brief Get the record
          *
@@ -546,6 +648,59 @@ class HexSection final
          */
         HexRecord getRecord(size_t index = 0) const;
 
+        /**
+         * @brief Get the revision of the section
+         *
+         * Revision is unique among all the sections and changes on every modification of
+         * the section (including the access through the non-const operator[]). Copies of a
+         * section share its revision until they are modified, so equal revisions imply
+         * equal contents.
+         *
+         * @return uint64_t Revision
+         * @note Writes through a reference returned by the non-const operator[] do not change
+         * the revision (see isDataReferenced), copies of such section get a new revision
+         */
+        uint64_t getRevision() const;
+
+        /**
+         * @brief Check if the data was referenced through the non-const operator[]
+         *
+         * The data of such section may change at any time without changing its revision.
+         *
+         * @return true Data was referenced
+         * @return false Data was not referenced since it was last replaced
+         */
+        bool isDataReferenced() const;
+
+        /**
+         * @brief Get the iterator to the first record
+         *
+         * @note Iterating through the records visits every data block once and does not copy the data
+         * @return HexRecordIterator Iterator to the first record
+         */
+        HexRecordIterator begin() const;
+
+        /**
+         * @brief Get the iterator to the first record with the data re-chunked into records
+         *
+         * Data of the contiguous blocks is split into records of up to recordDataSize bytes,
+         * which do not cross the multiples of recordAlignment (relative addresses). Section
+         * is not modified.
+         *
+         * @param recordDataSize Maximum data size of the records (0 yields a record per block)
+         * @param recordAlignment Alignment of the records (0 or 1 disables alignment, ignored if recordDataSize is 0)
+         * @throw std::out_of_range Record data size is out of range
+         * @return HexRecordIterator Iterator to the first record
+         */
+        HexRecordIterator begin(HexDataSizeType recordDataSize, HexDataSizeType recordAlignment = 0) const;
+
+        /**
+         * @brief Get the iterator past the last record
+         *
+         * @return HexRecordIterator Iterator past the last record
+         */
+        HexRecordIterator end() const;
+
         /**
          * @brief Check if record can be pushed to the section
          *
@@ -810,11 +965,162 @@ class HexSection final
          */
         void compact();
     protected:
+        friend class HexRecordIterator;
+
+        /**
+         * @brief Mark the section as modified by assigning it a new revision
+         *
+         */
+        void touch();
+
+        /**
+         * @brief Find the next record of the page storage
+         *
+         * @param address Address to search from (end of the previous record), set to the address of the record
+         * @param runEnd End of the contiguous data of the previous record, set to the end of the contiguous data of the record
+         * @return HexDataSizeType Data size of the record (0 if there are no more records)
+         */
+        HexDataSizeType findPageRecord(HexDataSizeType& address, HexDataSizeType& runEnd) const;
+
+        /**
+         * @brief Count the records of the page storage
+         *
+         * @param address Address to count the records below
+         * @return size_t Number of the data records starting below the address
+         */
+        size_t countPageRecords(HexDataSizeType address) const;
+
+        /**
+         * @brief Get a data record of the page storage
+         *
+         * @param record Record
+         * @param index Index of the data record
+         * @return true Getting the record successful
+         * @return false Index is out of range
+         */
+        bool getPageRecord(HexRecord& record, size_t index) const;
+
+        /**
+         * @brief Hex data block (start address and data)
+         *
+         */
+        typedef std::pair<HexDataAddressType, std::pmr::vector<HexDataType>> HexDataBlock;
+
+        /**
+         * @brief Hex data blocks sorted by the start address
+         *
+         */
+        typedef std::pmr::vector<HexDataBlock> HexDataBlockVector;
+
+        /**
+         * @brief Find the last data block starting at or before the address
+         *
+         * The block of the last lookup and the one following it are checked first,
+         * so sequential access is amortized constant time, otherwise the block
+         * is looked up by binary search.
+         *
+         * @param address Address
+         * @return HexDataBlockVector::const_iterator Data block (the block may end before the address)
+         * or end() if there is no such block
+         */
+        HexDataBlockVector::const_iterator findBlock(HexDataAddressType address) const;
+
+        /**
+         * @brief Find the last data block starting at or before the address
+         *
+         * @param address Address
+         * @return HexDataBlockVector::iterator Data block (the block may end before the address)
+         * or end() if there is no such block
+         */
+        HexDataBlockVector::iterator findBlock(HexDataAddressType address);
+
+        /**
+         * @brief Find the first data block which contains the address or starts after it
+         *
+         * @param address Address
+         * @return HexDataBlockVector::const_iterator Data block or end() if there is no such block
+         */
+        HexDataBlockVector::const_iterator findNextBlock(HexDataAddressType address) const;
+
+        /**
+         * @brief Find the first data block which contains the address or starts after it
+         *
+         * @param address Address
+         * @return HexDataBlockVector::iterator Data block or end() if there is no such block
+         */
+        HexDataBlockVector::iterator findNextBlock(HexDataAddressType address);
+
+        /**
+         * @brief Find the data block starting at the address or create an empty one
+         *
+         * @param address Start address of the block
+         * @return HexDataBlockVector::iterator Data block
+         * @note Iterators of the other blocks are invalidated if the block is created
+         */
+        HexDataBlockVector::iterator emplaceBlock(HexDataAddressType address);
+
+        /**
+         * @brief Push data of a data record
+         *
+         * Data is placed to the data blocks exactly like setting it byte by byte would
+         * (overwriting existing data, appending to the blocks until they are multiple
+         * of the default data size, otherwise creating new blocks), but is copied in
+         * runs with a single lookup per run.
+         *
+         * @param address Address of the data (wraps around at the end of the section)
+         * @param data Pointer to the data
+         * @param dataSize Size of the data
+         */
+        void pushData(HexDataAddressType address, const HexDataType* data, HexDataSizeType dataSize);
+
+        /**
+         * @brief Make the data of the used storage unique before modifying it
+         *
+         * Copies of a section share the data until one of them modifies it.
+         */
+        void unshareData();
+
+        /**
+         * @brief Replace the data with the shared empty data
+         *
+         */
+        void resetData();
+
+        /**
+         * @brief Get the data blocks for a copy of the section
+         *
+         * @param allocator Allocator of the copy
+         * @return std::shared_ptr<HexDataBlockVector> Shared data blocks if the allocators are equal and the data is not referenced, copied otherwise
+         */
+        std::shared_ptr<HexDataBlockVector> shareBlocks(const allocator_type& allocator) const;
+
+        /**
+         * @brief Get the page for a copy of the section
+         *
+         * @param allocator Allocator of the copy
+         * @return std::shared_ptr<HexPage> Shared page if the allocators are equal and the data is not referenced, copied otherwise
+         */
+        std::shared_ptr<HexPage> sharePage(const allocator_type& allocator) const;
+
+        /**
+         * @brief Get the empty data blocks shared by all sections
+         *
+         * @return const std::shared_ptr<HexDataBlockVector>& Empty data blocks
+         */
+        static const std::shared_ptr<HexDataBlockVector>& getEmptyBlocks();
+
         /**
-         * @brief Hex data map
+         * @brief Get the empty page shared by all sections
          *
+         * @return const std::shared_ptr<HexPage>& Empty page
          */
-        typedef std::map<HexDataAddressType, HexDataVector> HexDataMap;
+        static const std::shared_ptr<HexPage>& getEmptyPage();
+
+        /**
+         * @brief Reset the block of the last lookup
+         *
+         */
+        void resetBlockCursor() const;
 
         /**
          * @brief Main record of the section
@@ -823,10 +1129,10 @@ class HexSection final
         HexRecord section;
 
         /**
-         * @brief Hex data blocks
+         * @brief Hex data blocks (shared by the copies of the section until modified)
          *
          */
-        HexDataMap blocks;
+        std::shared_ptr<HexDataBlockVector> blocks;
 
         /**
          * @brief Unused data fill value
@@ -839,6 +1145,43 @@ class HexSection final
          *
          */
         HexDataSizeType defaultDataSize;
+
+        /**
+         * @brief Revision of the section
+         *
+         */
+        uint64_t revision;
+
+        /**
+         * @brief Storage type of the data
+         *
+         */
+        HexSectionStorageType storageType;
+
+        /**
+         * @brief Hex data page (STORAGE_PAGE only, shared by the copies of the section until modified)
+         *
+         */
+        std::shared_ptr<HexPage> page;
+
+        /**
+         * @brief Data was referenced through the non-const operator[] (it is not shared anymore)
+         *
+         */
+        bool referenced;
+
+        /**
+         * @brief Index of the data block of the last lookup (std::string::npos if not set)
+         *
+         * @note Atomic so that concurrent const lookups of the section remain safe
+         */
+        mutable std::atomic<size_t> blockCursor;
+
+        /**
+         * @brief Allocator of the data
+         *
+         */
+        allocator_type allocator;
 };
 
 /**
@@ -857,6 +1200,189 @@ typedef std::unique_ptr<HexSection> HexSectionUniquePtr;
  * @brief Hex section vector
  *
  */
-typedef std::vector<HexSection> HexSectionVector;
+typedef std::pmr::vector<HexSection> HexSectionVector;
+
+/**
+ * @brief HexRecordIterator class
+ *
+ * Forward iterator through the records of a HexSection, which yields
+ * record views of the section record and of the data blocks. Iterator is
+ * invalidated by any modification of the section.
+ *
+ */
+class HexRecordIterator final
+{
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef HexRecordView value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const HexRecordView* pointer;
+        typedef const HexRecordView& reference;
+
+        /**
+         * @brief Construct a new HexRecordIterator object, which does not refer to any section
+         *
+         */
+        explicit HexRecordIterator();
+
+        /**
+         * @brief Construct a new HexRecordIterator object
+         *
+         * @param section Section to iterate through
+         * @param end Construct the iterator past the last record
+         * @param recordDataSize Maximum data size of the records (0 yields a record per block)
+         * @param recordAlignment Alignment of the records (0 or 1 disables alignment, ignored if recordDataSize is 0)
+         * @throw std::out_of_range Data block size or record data size is out of range
+         */
+        explicit HexRecordIterator(const HexSection& section, bool end = false, HexDataSizeType recordDataSize = 0, HexDataSizeType recordAlignment = 0);
+
+        /**
+         * @brief Copy-construct a new HexRecordIterator object
+         *
+         * @param iterator Iterator to copy-construct from
+         */
+        HexRecordIterator(const HexRecordIterator& iterator);
+
+        /**
+         * @brief Copy-assignment operator
+         *
+         * @param iterator Iterator to copy-assign from
+         * @return HexRecordIterator& Reference to the current iterator
+         */
+        HexRecordIterator& operator=(const HexRecordIterator& iterator);
+
+        /**
+         * @brief Get the current record
+         *
+         * @return reference Current record view
+         */
+        reference operator*() const;
+
+        /**
+         * @brief Get the current record
+         *
+         * @return pointer Current record view
+         */
+        pointer operator->() const;
+
+        /**
+         * @brief Advance to the next record
+         *
+         * @throw std::out_of_range Data block size is out of range
+         * @return HexRecordIterator& Advanced iterator
+         */
+        HexRecordIterator& operator++();
+
+        /**
+         * @brief Advance to the next record
+         *
+         * @throw std::out_of_range Data block size is out of range
+         * @return HexRecordIterator Iterator before advancing
+         */
+        HexRecordIterator operator++(int);
+
+        /**
+         * @brief Compare iterators
+         *
+         * @param other Iterator to compare to
+         * @return true Iterators refer to the same record
+         * @return false Iterators refer to different records
+         */
+        bool operator==(const HexRecordIterator& other) const;
+
+        /**
+         * @brief Compare iterators
+         *
+         * @param other Iterator to compare to
+         * @return true Iterators refer to different records
+         * @return false Iterators refer to the same record
+         */
+        bool operator!=(const HexRecordIterator& other) const;
+    protected:
+        /**
+         * @brief Update the current record view
+         *
+         * @throw std::out_of_range Data block size is out of range
+         */
+        void updateRecord();
+
+        /**
+         * @brief Section to iterate through
+         *
+         */
+        const HexSection* section;
+
+        /**
+         * @brief Iterator is at the section record
+         *
+         */
+        bool sectionRecord;
+
+        /**
+         * @brief Current data block
+         *
+         */
+        HexSection::HexDataBlockVector::const_iterator block;
+
+        /**
+         * @brief Offset of the current record in the current data block
+         *
+         */
+        HexDataSizeType blockOffset;
+
+        /**
+         * @brief Data block of the next record
+         *
+         */
+        HexSection::HexDataBlockVector::const_iterator nextBlock;
+
+        /**
+         * @brief Offset of the next record in its data block
+         *
+         */
+        HexDataSizeType nextBlockOffset;
+
+        /**
+         * @brief Address of the current record in the data page (HEX_PAGE_SIZE when not iterating the page)
+         *
+         */
+        HexDataSizeType pageAddress;
+
+        /**
+         * @brief End of the contiguous data of the current record in the data page
+         *
+         */
+        HexDataSizeType pageRunEnd;
+
+        /**
+         * @brief Maximum data size of the records (0 yields a record per block)
+         *
+         */
+        HexDataSizeType recordDataSize;
+
+        /**
+         * @brief Alignment of the records
+         *
+         */
+        HexDataSizeType recordAlignment;
+
+        /**
+         * @brief Data of the record gathered from several blocks
+         *
+         */
+        HexDataArray<> data;
+
+        /**
+         * @brief Current record view refers to the gathered data
+         *
+         */
+        bool gathered;
+
+        /**
+         * @brief Current record view
+         *
+         */
+        HexRecordView record;
+};
 
 END_NAMESPACE_LIBIHEX
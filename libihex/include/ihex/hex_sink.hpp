@@ -0,0 +1,366 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <ihex/version.hpp>
+
+#if defined(__unix__) || defined(__APPLE__) || defined(_WIN32)
+/**
+ * @brief HexFileDescriptorSink is available on platforms with file descriptors
+ *
+ */
+#define LIBIHEX_HEX_SINK_DESCRIPTOR
+#endif
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief Default size of the sink buffer
+ *
+ */
+static constexpr size_t DEFAULT_HEX_SINK_BUFFER_SIZE{0x40000};
+
+/**
+ * @brief HexSink class
+ *
+ * Base class of the output sinks. Data is collected in a user-space buffer
+ * and passed to the output of the derived class once the buffer is full,
+ * on flush and on destruction of the derived class. Data larger than the
+ * buffer bypasses it.
+ *
+ */
+class HexSink
+{
+    public:
+        /**
+         * @brief Construct a new HexSink object
+         *
+         * @param bufferSize Size of the buffer
+         */
+        explicit HexSink(size_t bufferSize = DEFAULT_HEX_SINK_BUFFER_SIZE);
+
+        /**
+         * @brief Destroy the HexSink object
+         *
+         * @note Derived classes flush the buffer on destruction
+         */
+        virtual ~HexSink();
+
+        /**
+         * @brief Write data
+         *
+         * @param data Pointer to the data
+         * @param dataSize Size of the data
+         * @return true Successfully written data
+         * @return false Failed to output the data
+         */
+        virtual bool write(const char* data, size_t dataSize);
+
+        /**
+         * @brief Prepare space for writing data in place
+         *
+         * @param dataSize Size of the space (the buffer is grown if it is smaller)
+         * @note Data written to the space is written by commit
+         * @return char* Pointer to the space or nullptr if output of the pending data failed
+         */
+        virtual char* prepare(size_t dataSize);
+
+        /**
+         * @brief Commit data written to the prepared space
+         *
+         * @param dataSize Size of the data (at most the size of the prepared space)
+         */
+        virtual void commit(size_t dataSize);
+
+        /**
+         * @brief Output the pending data
+         *
+         * @return true Successfully output the pending data
+         * @return false Failed to output the pending data
+         */
+        virtual bool flush();
+
+        /**
+         * @brief Get the size of the buffer
+         *
+         * @return size_t Size of the buffer
+         */
+        size_t getBufferSize() const;
+
+        /**
+         * @brief Get the size of the pending data
+         *
+         * @return size_t Size of the data in the buffer, which was not output yet
+         */
+        size_t getPendingSize() const;
+    protected:
+        /**
+         * @brief Output data
+         *
+         * @param data Pointer to the data
+         * @param dataSize Size of the data
+         * @return true Successfully output data
+         * @return false Failed to output data
+         */
+        virtual bool output(const char* data, size_t dataSize) = 0;
+
+        /**
+         * @brief Output two blocks of data
+         *
+         * @param first Pointer to the first block of data
+         * @param firstSize Size of the first block of data
+         * @param second Pointer to the second block of data
+         * @param secondSize Size of the second block of data
+         * @return true Successfully output data
+         * @return false Failed to output data
+         */
+        virtual bool output(const char* first, size_t firstSize, const char* second, size_t secondSize);
+
+        /**
+         * @brief Buffer of the pending data
+         *
+         */
+        std::vector<char> buffer;
+
+        /**
+         * @brief Size of the pending data
+         *
+         */
+        size_t pendingSize;
+};
+
+/**
+ * @brief Shared pointer of HexSink
+ *
+ */
+typedef std::shared_ptr<HexSink> HexSinkPtr;
+
+/**
+ * @brief Unique pointer of HexSink
+ *
+ */
+typedef std::unique_ptr<HexSink> HexSinkUniquePtr;
+
+#ifdef LIBIHEX_HEX_SINK_DESCRIPTOR
+/**
+ * @brief HexFileDescriptorSink class
+ *
+ * Sink writing to a file descriptor with write (and writev where supported).
+ * File descriptor is not closed by the sink.
+ *
+ */
+class HexFileDescriptorSink final : public HexSink
+{
+    public:
+        /**
+         * @brief Construct a new HexFileDescriptorSink object
+         *
+         * @param descriptor File descriptor open for writing
+         * @param bufferSize Size of the buffer
+         */
+        explicit HexFileDescriptorSink(int descriptor, size_t bufferSize = DEFAULT_HEX_SINK_BUFFER_SIZE);
+
+        /**
+         * @brief Destroy the HexFileDescriptorSink object and flush the buffer
+         *
+         */
+        virtual ~HexFileDescriptorSink();
+
+        /**
+         * @brief Get the file descriptor
+         *
+         * @return int File descriptor
+         */
+        int getDescriptor() const;
+    protected:
+        /**
+         * @brief Output data
+         *
+         * @param data Pointer to the data
+         * @param dataSize Size of the data
+         * @return true Successfully output data
+         * @return false Failed to output data
+         */
+        virtual bool output(const char* data, size_t dataSize) override;
+
+        /**
+         * @brief Output two blocks of data with a single call where supported
+         *
+         * @param first Pointer to the first block of data
+         * @param firstSize Size of the first block of data
+         * @param second Pointer to the second block of data
+         * @param secondSize Size of the second block of data
+         * @return true Successfully output data
+         * @return false Failed to output data
+         */
+        virtual bool output(const char* first, size_t firstSize, const char* second, size_t secondSize) override;
+
+        /**
+         * @brief File descriptor
+         *
+         */
+        int descriptor;
+};
+#endif
+
+/**
+ * @brief HexMemorySink class
+ *
+ * Sink appending to a string in memory. Data is appended directly, without
+ * an intermediate buffer.
+ *
+ */
+class HexMemorySink final : public HexSink
+{
+    public:
+        /**
+         * @brief Construct a new HexMemorySink object
+         *
+         * @param reserveSize Size of the memory to reserve up front
+         */
+        explicit HexMemorySink(size_t reserveSize = 0);
+
+        /**
+         * @brief Destroy the HexMemorySink object
+         *
+         */
+        virtual ~HexMemorySink();
+
+        /**
+         * @brief Write data
+         *
+         * @param data Pointer to the data
+         * @param dataSize Size of the data
+         * @return true Always
+         */
+        virtual bool write(const char* data, size_t dataSize) override;
+
+        /**
+         * @brief Prepare space for writing data in place
+         *
+         * @param dataSize Size of the space
+         * @return char* Pointer to the space
+         */
+        virtual char* prepare(size_t dataSize) override;
+
+        /**
+         * @brief Commit data written to the prepared space
+         *
+         * @param dataSize Size of the data (at most the size of the prepared space)
+         */
+        virtual void commit(size_t dataSize) override;
+
+        /**
+         * @brief Output the pending data
+         *
+         * @return true Always (there is no pending data)
+         */
+        virtual bool flush() override;
+
+        /**
+         * @brief Get the written data
+         *
+         * @return const std::string& Written data
+         */
+        const std::string& getData() const;
+
+        /**
+         * @brief Move the written data out of the sink and clear it
+         *
+         * @return std::string Written data
+         */
+        std::string releaseData();
+
+        /**
+         * @brief Clear the written data
+         *
+         */
+        void clear();
+    protected:
+        /**
+         * @brief Output data
+         *
+         * @param data Pointer to the data
+         * @param dataSize Size of the data
+         * @return true Always
+         */
+        virtual bool output(const char* data, size_t dataSize) override;
+
+        /**
+         * @brief Written data (followed by the prepared space until it is committed)
+         *
+         */
+        std::string data;
+
+        /**
+         * @brief Size of the prepared space
+         *
+         */
+        size_t preparedSize;
+};
+
+/**
+ * @brief HexStreamSink class
+ *
+ * Sink adapter writing the buffer to a stream with unformatted writes.
+ *
+ */
+class HexStreamSink final : public HexSink
+{
+    public:
+        /**
+         * @brief Construct a new HexStreamSink object
+         *
+         * @param stream Stream
+         * @param bufferSize Size of the buffer
+         */
+        explicit HexStreamSink(std::ostream& stream, size_t bufferSize = DEFAULT_HEX_SINK_BUFFER_SIZE);
+
+        /**
+         * @brief Destroy the HexStreamSink object and flush the buffer
+         *
+         */
+        virtual ~HexStreamSink();
+    protected:
+        /**
+         * @brief Output data
+         *
+         * @param data Pointer to the data
+         * @param dataSize Size of the data
+         * @return true Successfully output data
+         * @return false Stream failed
+         */
+        virtual bool output(const char* data, size_t dataSize) override;
+
+        /**
+         * @brief Stream
+         *
+         */
+        std::ostream& stream;
+};
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,280 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <stdint.h>
+#include <ihex/hex_address.hpp>
+#include <ihex/hex_record.hpp>
+#include <ihex/version.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief HexVisitor class
+ *
+ * Streaming interface, which decodes the records and reports their content
+ * through the virtual callback functions without building any sections.
+ * Data is reported at the absolute addresses, resolved the same way as when
+ * the records are loaded into a HexFile. Memory use does not depend on the
+ * size of the input.
+ *
+ * Derive from this class and override the callbacks of interest.
+ *
+ */
+class HexVisitor
+{
+    public:
+        /**
+         * @brief Construct a new HexVisitor object
+         *
+         */
+        explicit HexVisitor();
+
+        /**
+         * @brief Copy-construct a new HexVisitor object
+         *
+         * @param visitor Visitor to copy-construct from
+         */
+        HexVisitor(const HexVisitor& visitor) = default;
+
+        /**
+         * @brief Move-construct a new HexVisitor object
+         *
+         * @param visitor Visitor to move-construct from
+         */
+        HexVisitor(HexVisitor&& visitor) = default;
+
+        /**
+         * @brief Destroy the HexVisitor object
+         *
+         */
+        virtual ~HexVisitor() = default;
+
+        /**
+         * @brief Copy-assignment operator
+         *
+         * @param visitor Visitor to copy-assign
+         * @return HexVisitor& Assigned visitor
+         */
+        HexVisitor& operator=(const HexVisitor& visitor) = default;
+
+        /**
+         * @brief Move-assignment operator
+         *
+         * @param visitor Visitor to move-assign
+         * @return HexVisitor& Assigned visitor
+         */
+        HexVisitor& operator=(HexVisitor&& visitor) = default;
+
+        /**
+         * @brief Visit records from a file
+         *
+         * @param fileName File name
+         * @return true Successfully visited all the records
+         * @return false Failed to open the file, found an invalid record or the visit was stopped
+         */
+        bool visit(const std::string& fileName);
+
+        /**
+         * @brief Visit records from a stream
+         *
+         * @param stream Input stream
+         * @return true Successfully visited all the records
+         * @return false Found an invalid record or the visit was stopped
+         */
+        bool visit(std::istream& stream);
+
+        /**
+         * @brief Visit records from a memory buffer
+         *
+         * @param data Pointer to the hex file contents
+         * @param dataSize Size of the hex file contents
+         * @note Trailing data without line separator is visited as the last line
+         * @return true Successfully visited all the records
+         * @return false Found an invalid record or the visit was stopped
+         */
+        bool visit(const char* data, size_t dataSize);
+
+        /**
+         * @brief Visit a single record line
+         *
+         * @param line Record line (without line separator, empty lines are ignored)
+         * @return true Successfully visited the record
+         * @return false Found an invalid record
+         */
+        bool visitLine(std::string_view line);
+
+        /**
+         * @brief Reset the address resolution to the ADDRESS_I8HEX address space and the line position to the start of the input
+         *
+         * @note Address resolution and line position are kept between the visits
+         *   to allow visiting the input in parts, reset them before visiting a new input
+         */
+        void reset();
+
+        /**
+         * @brief Get the number of the line being visited
+         *
+         * @note Valid during the callbacks, lines are numbered from 1
+         * @return size_t Line number (number of visited lines after the visit)
+         */
+        size_t getLineNumber() const;
+
+        /**
+         * @brief Get the offset of the line being visited
+         *
+         * @note Valid during the callbacks
+         * @return size_t Offset of the first character of the line from the start of the input
+         */
+        size_t getLineOffset() const;
+
+        /**
+         * @brief Get the address type used for the data records
+         *
+         * @return HexAddressEnumType Address type set by the last extended address record
+         */
+        HexAddressEnumType getAddressType() const;
+
+        /**
+         * @brief Get the extended address used for the data records
+         *
+         * @return uint16_t Extended segment or linear address (0 for ADDRESS_I8HEX address type)
+         */
+        uint16_t getExtendedAddress() const;
+
+    protected:
+        /**
+         * @brief Called for every contiguous run of data
+         *
+         * @param address Absolute address of the first byte
+         * @param data Pointer to the data (valid during the call only)
+         * @param dataSize Size of the data
+         * @note Data record wrapping the address space is reported as multiple runs
+         */
+        virtual void onData(HexAddressType address, const HexDataType* data, HexDataSizeType dataSize);
+
+        /**
+         * @brief Called for a RECORD_END_OF_FILE record
+         *
+         */
+        virtual void onEndOfFile();
+
+        /**
+         * @brief Called for a RECORD_EXTENDED_SEGMENT_ADDRESS record
+         *
+         * @param segmentAddress Segment address
+         */
+        virtual void onExtendedSegmentAddress(uint16_t segmentAddress);
+
+        /**
+         * @brief Called for a RECORD_START_SEGMENT_ADDRESS record
+         *
+         * @param codeSegment Code segment
+         * @param instructionPointer Instruction pointer
+         */
+        virtual void onStartSegmentAddress(uint16_t codeSegment, uint16_t instructionPointer);
+
+        /**
+         * @brief Called for a RECORD_EXTENDED_LINEAR_ADDRESS record
+         *
+         * @param linearAddress Linear address
+         */
+        virtual void onExtendedLinearAddress(uint16_t linearAddress);
+
+        /**
+         * @brief Called for a RECORD_START_LINEAR_ADDRESS record
+         *
+         * @param extendedInstructionPointer Extended instruction pointer
+         */
+        virtual void onStartLinearAddress(uint32_t extendedInstructionPointer);
+
+        /**
+         * @brief Called for a line which is not a valid record
+         *
+         * @param line Line
+         * @return true Continue the visit
+         * @return false Stop the visit
+         */
+        virtual bool onInvalidRecord(std::string_view line);
+
+        /**
+         * @brief Called for a record with checksum mismatch
+         *
+         * @param line Line
+         * @return true Continue the visit
+         * @return false Stop the visit
+         */
+        virtual bool onChecksumMismatch(std::string_view line);
+
+        /**
+         * @brief Process a single record line
+         *
+         * @param line Record line
+         * @param lineSize Size of the line in the input (including line separator)
+         * @param result Cleared if the record is invalid
+         * @return true Continue the visit
+         * @return false Stop the visit
+         */
+        bool processLine(std::string_view line, size_t lineSize, bool& result);
+
+        /**
+         * @brief Reset the address resolution to the ADDRESS_I8HEX address space
+         *
+         */
+        void resetAddress();
+
+        /**
+         * @brief Address type used for the data records
+         *
+         */
+        HexAddressEnumType addressType;
+
+        /**
+         * @brief Extended address used for the data records
+         *
+         */
+        uint16_t extendedAddress;
+
+        /**
+         * @brief Number of the line being visited
+         *
+         */
+        size_t lineNumber;
+
+        /**
+         * @brief Offset of the line being visited
+         *
+         */
+        size_t lineOffset;
+
+        /**
+         * @brief Offset of the next line
+         *
+         */
+        size_t nextLineOffset;
+};
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,292 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ihex/hex_address.hpp>
+#include <ihex/hex_record.hpp>
+#include <ihex/hex_sink.hpp>
+#include <ihex/version.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief Default size of the writer window
+ *
+ */
+static constexpr HexAddressType DEFAULT_HEX_WRITER_WINDOW_SIZE{0x10000};
+
+/**
+ * @brief HexWriter class
+ *
+ * Streams data records to a sink without building sections. Data written
+ * within the window is collected and emitted in address order once the window
+ * moves past it. Extended address records are emitted whenever the upper part
+ * of the address changes, start address and end of file records are emitted
+ * by finish.
+ *
+ */
+class HexWriter
+{
+    public:
+        /**
+         * @brief Construct a new HexWriter object
+         *
+         * @param sink Sink to write the records to
+         * @param addressType Address type of the records (ADDRESS_I8HEX, ADDRESS_I16HEX or ADDRESS_I32HEX)
+         * @param recordDataSize Maximum data size of the data records
+         * @param windowSize Size of the window for writing unsorted data
+         * @throw std::invalid_argument Address type is not valid
+         * @throw std::out_of_range Record data size or window size is out of range
+         */
+        explicit HexWriter(HexSink& sink, HexAddressEnumType addressType = HexAddressEnumType::ADDRESS_I32HEX,
+            HexDataSizeType recordDataSize = DEFAULT_HEX_RECORD_DATA_SIZE, HexAddressType windowSize = DEFAULT_HEX_WRITER_WINDOW_SIZE);
+
+        /**
+         * @brief Destroy the HexWriter object
+         *
+         * @note Pending data is not emitted (see finish)
+         */
+        virtual ~HexWriter();
+
+        /**
+         * @brief Write data
+         *
+         * Data can be written in any order, as long as it does not start below the
+         * window. Window covers windowSize addresses and slides forward (by at least
+         * half of its size) when data is written past its end. Data written again to
+         * the same addresses within the window replaces the previous data.
+         *
+         * @param address Absolute address of the data
+         * @param data Pointer to the data
+         * @param dataSize Size of the data
+         * @throw std::out_of_range Address range is not valid for the address type or starts below the window
+         * @throw std::logic_error Writer was already finished
+         * @return true Successfully written data
+         * @return false Failed to output the records
+         */
+        virtual bool write(HexAddressType address, const HexDataType* data, HexDataSizeType dataSize);
+
+        /**
+         * @brief Write data
+         *
+         * @param address Absolute address of the data
+         * @param data Data
+         * @throw std::out_of_range Address range is not valid for the address type or starts below the window
+         * @throw std::logic_error Writer was already finished
+         * @return true Successfully written data
+         * @return false Failed to output the records
+         */
+        virtual bool write(HexAddressType address, const HexDataVector& data);
+
+        /**
+         * @brief Set the start segment address emitted by finish
+         *
+         * @param codeSegment Code segment (CS)
+         * @param instructionPointer Instruction pointer (IP)
+         * @throw std::domain_error Address type is not ADDRESS_I16HEX
+         */
+        virtual void setStartSegmentAddress(uint16_t codeSegment, uint16_t instructionPointer);
+
+        /**
+         * @brief Set the start linear address emitted by finish
+         *
+         * @param extendedInstructionPointer Extended instruction pointer (EIP)
+         * @throw std::domain_error Address type is not ADDRESS_I32HEX
+         */
+        virtual void setStartLinearAddress(uint32_t extendedInstructionPointer);
+
+        /**
+         * @brief Emit the data in the window and flush the sink
+         *
+         * @note Data written after flush can not start below the end of the flushed data
+         * @return true Successfully flushed the data
+         * @return false Failed to output the records
+         */
+        virtual bool flush();
+
+        /**
+         * @brief Emit the data in the window, start address and end of file records and flush the sink
+         *
+         * @throw std::logic_error Writer was already finished
+         * @return true Successfully finished the records
+         * @return false Failed to output the records
+         */
+        virtual bool finish();
+
+        /**
+         * @brief Check if the writer was finished
+         *
+         * @return true Writer was finished
+         * @return false Writer was not finished
+         */
+        virtual bool isFinished() const;
+
+        /**
+         * @brief Get the address type
+         *
+         * @return HexAddressEnumType Address type of the records
+         */
+        virtual HexAddressEnumType getAddressType() const;
+
+        /**
+         * @brief Get the maximum data size of the data records
+         *
+         * @return HexDataSizeType Maximum data size
+         */
+        virtual HexDataSizeType getRecordDataSize() const;
+
+        /**
+         * @brief Get the size of the window
+         *
+         * @return HexAddressType Size of the window
+         */
+        virtual HexAddressType getWindowSize() const;
+
+        /**
+         * @brief Get the line separator
+         *
+         * @return std::string Line separator written after every record
+         */
+        virtual std::string getLineSeparator() const;
+
+        /**
+         * @brief Set the line separator
+         *
+         * @param lineSeparator Line separator written after every record
+         * @throw std::invalid_argument Line separator is empty
+         */
+        virtual void setLineSeparator(const std::string& lineSeparator = std::string(1, HEX_RECORD_LINE_SEPARATOR));
+    protected:
+        /**
+         * @brief Emit the data at the start of the window and move the window past it
+         *
+         * @param count Number of addresses to move the window by (data is emitted up to the end of the window)
+         * @return true Successfully emitted the data
+         * @return false Failed to output the records
+         */
+        bool emitWindow(HexDataSizeType count);
+
+        /**
+         * @brief Emit a data record (preceded by an extended address record when required)
+         *
+         * @param address Absolute address of the data
+         * @param data Pointer to the data
+         * @param dataSize Size of the data (data does not cross a 64 KiB boundary)
+         * @return true Successfully emitted the records
+         * @return false Failed to output the records
+         */
+        bool emitDataRecord(HexAddressType address, const HexDataType* data, HexDataSizeType dataSize);
+
+        /**
+         * @brief Emit a record
+         *
+         * @param record Record
+         * @return true Successfully emitted the record
+         * @return false Failed to output the record
+         */
+        bool emitRecord(const HexRecordView& record);
+
+        /**
+         * @brief Sink to write the records to
+         *
+         */
+        HexSink& sink;
+
+        /**
+         * @brief Address type of the records
+         *
+         */
+        HexAddressEnumType addressType;
+
+        /**
+         * @brief Maximum data size of the data records
+         *
+         */
+        HexDataSizeType recordDataSize;
+
+        /**
+         * @brief Line separator
+         *
+         */
+        std::string lineSeparator;
+
+        /**
+         * @brief Data of the window
+         *
+         */
+        std::vector<HexDataType> window;
+
+        /**
+         * @brief Flags of the written addresses of the window
+         *
+         */
+        std::vector<bool> windowUsed;
+
+        /**
+         * @brief Absolute address of the start of the window (reaches past the address space once it is written up to the end)
+         *
+         */
+        uint64_t windowAddress;
+
+        /**
+         * @brief Window was positioned by a write
+         *
+         */
+        bool windowValid;
+
+        /**
+         * @brief Upper part of the address of the emitted records (extended segment or linear address)
+         *
+         */
+        uint16_t extendedAddress;
+
+        /**
+         * @brief Start address record emitted by finish (RECORD_END_OF_FILE when not set)
+         *
+         */
+        HexRecord startAddress;
+
+        /**
+         * @brief Writer was finished
+         *
+         */
+        bool finished;
+};
+
+/**
+ * @brief Shared pointer of HexWriter
+ *
+ */
+typedef std::shared_ptr<HexWriter> HexWriterPtr;
+
+/**
+ * @brief Unique pointer of HexWriter
+ *
+ */
+typedef std::unique_ptr<HexWriter> HexWriterUniquePtr;
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,546 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <array>
+#include <stdexcept>
+#include <ihex/hex_codec.hpp>
+
+#if defined(LIBIHEX_ENABLE_SIMD) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LIBIHEX_HEX_CODEC_X86
+#include <immintrin.h>
+#endif
+
+BEGIN_NAMESPACE_LIBIHEX
+
+namespace
+{
+    /**
+     * @brief Marker of a character which is not a hex digit
+     *
+     */
+    constexpr HexDataType INVALID_HEX_DIGIT{0xFF};
+
+    /**
+     * @brief Build the hex digit decoding lookup table
+     *
+     * @return std::array<HexDataType, 256> Value of every character or INVALID_HEX_DIGIT
+     */
+    constexpr std::array<HexDataType, 256> makeDecodeTable()
+    {
+        std::array<HexDataType, 256> result{};
+        for (auto& value : result)
+            value = INVALID_HEX_DIGIT;
+
+        for (HexDataType index{0}; index < 10; ++index)
+            result[static_cast<unsigned char>('0' + index)] = index;
+
+        for (HexDataType index{0}; index < 6; ++index)
+        {
+            result[static_cast<unsigned char>('A' + index)] = 10 + index;
+            result[static_cast<unsigned char>('a' + index)] = 10 + index;
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Hex digit decoding lookup table
+     *
+     */
+    constexpr std::array<HexDataType, 256> decodeTable{makeDecodeTable()};
+
+    /**
+     * @brief Build the hex digit pair encoding lookup table
+     *
+     * @return std::array<char, 512> Two uppercase hex digits of every byte
+     */
+    constexpr std::array<char, 512> makeEncodeTable()
+    {
+        constexpr char digits[]{"0123456789ABCDEF"};
+        std::array<char, 512> result{};
+        for (size_t index{0}; index < 256; ++index)
+        {
+            result[2 * index] = digits[index >> 4];
+            result[(2 * index) + 1] = digits[index & 0x0F];
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Hex digit pair encoding lookup table
+     *
+     */
+    constexpr std::array<char, 512> encodeTable{makeEncodeTable()};
+
+    /**
+     * @brief Decode function type of the kernels
+     *
+     */
+    typedef bool (*DecodeFunction)(const char* text, HexDataType* data, HexDataSizeType dataSize);
+
+    /**
+     * @brief Encode function type of the kernels
+     *
+     */
+    typedef void (*EncodeFunction)(const HexDataType* data, HexDataSizeType dataSize, char* text);
+
+    /**
+     * @brief Decode data with the lookup table
+     *
+     * @param text Pointer to (2 * dataSize) hex digits
+     * @param data Pointer to the data to decode to
+     * @param dataSize Size of the data to decode
+     * @return true Successfully decoded all of the data
+     * @return false Any of the characters is not a hex digit
+     */
+    bool decodeScalar(const char* text, HexDataType* data, HexDataSizeType dataSize)
+    {
+        // Accumulate invalid digit markers and check them once at the end
+        HexDataType invalid{0};
+        for (HexDataSizeType index{0}; index < dataSize; ++index)
+        {
+            auto high{decodeTable[static_cast<unsigned char>(text[2 * index])]};
+            auto low{decodeTable[static_cast<unsigned char>(text[(2 * index) + 1])]};
+            invalid |= (high | low);
+            data[index] = static_cast<HexDataType>((high << 4) | (low & 0x0F));
+        }
+
+        return ((invalid & 0xF0) == 0);
+    }
+
+    /**
+     * @brief Encode data with the lookup table
+     *
+     * @param data Pointer to the data to encode
+     * @param dataSize Size of the data to encode
+     * @param text Pointer to the (2 * dataSize) characters to encode to
+     */
+    void encodeScalar(const HexDataType* data, HexDataSizeType dataSize, char* text)
+    {
+        for (HexDataSizeType index{0}; index < dataSize; ++index)
+        {
+            const auto digits{encodeTable.data() + (2 * data[index])};
+            text[2 * index] = digits[0];
+            text[(2 * index) + 1] = digits[1];
+        }
+    }
+
+#ifdef LIBIHEX_HEX_CODEC_X86
+    /**
+     * @brief Convert 16 hex digits to their values
+     *
+     * @param text Hex digits
+     * @param valid Mask of the valid digits (0xFF per valid digit)
+     * @return __m128i Digit values
+     */
+    __attribute__((target("sse2")))
+    inline __m128i decodeNibblesSse2(__m128i text, __m128i& valid)
+    {
+        // Digits '0'-'9' are at most 9 after the subtraction
+        auto digit{_mm_sub_epi8(text, _mm_set1_epi8('0'))};
+        auto isDigit{_mm_cmpeq_epi8(_mm_max_epu8(digit, _mm_set1_epi8(9)), _mm_set1_epi8(9))};
+
+        // Letters 'A'-'F' and 'a'-'f' are at most 5 after folding the case and the subtraction
+        auto letter{_mm_sub_epi8(_mm_or_si128(text, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'))};
+        auto isLetter{_mm_cmpeq_epi8(_mm_max_epu8(letter, _mm_set1_epi8(5)), _mm_set1_epi8(5))};
+
+        valid = _mm_or_si128(isDigit, isLetter);
+        return _mm_or_si128(_mm_and_si128(isDigit, digit),
+            _mm_and_si128(isLetter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+    }
+
+    /**
+     * @brief Decode data with SSE2 (16 hex digits per step)
+     *
+     * @param text Pointer to (2 * dataSize) hex digits
+     * @param data Pointer to the data to decode to
+     * @param dataSize Size of the data to decode
+     * @return true Successfully decoded all of the data
+     * @return false Any of the characters is not a hex digit
+     */
+    __attribute__((target("sse2")))
+    bool decodeSse2(const char* text, HexDataType* data, HexDataSizeType dataSize)
+    {
+        auto valid{_mm_set1_epi8(-1)};
+        HexDataSizeType index{0};
+        for (; (index + 8) <= dataSize; index += 8)
+        {
+            __m128i digitsValid;
+            auto nibbles{decodeNibblesSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + (2 * index))), digitsValid)};
+            valid = _mm_and_si128(valid, digitsValid);
+
+            // Combine high (even) and low (odd) nibbles of every 16-bit lane
+            auto high{_mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4)};
+            auto low{_mm_srli_epi16(nibbles, 8)};
+            auto bytes{_mm_packus_epi16(_mm_or_si128(high, low), _mm_setzero_si128())};
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(data + index), bytes);
+        }
+
+        auto result{_mm_movemask_epi8(valid) == 0xFFFF};
+        return (decodeScalar(text + (2 * index), data + index, dataSize - index) && result);
+    }
+
+    /**
+     * @brief Decode data with SSSE3 (16 hex digits per step)
+     *
+     * @param text Pointer to (2 * dataSize) hex digits
+     * @param data Pointer to the data to decode to
+     * @param dataSize Size of the data to decode
+     * @return true Successfully decoded all of the data
+     * @return false Any of the characters is not a hex digit
+     */
+    __attribute__((target("ssse3")))
+    bool decodeSsse3(const char* text, HexDataType* data, HexDataSizeType dataSize)
+    {
+        auto valid{_mm_set1_epi8(-1)};
+        HexDataSizeType index{0};
+        for (; (index + 8) <= dataSize; index += 8)
+        {
+            __m128i digitsValid;
+            auto nibbles{decodeNibblesSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + (2 * index))), digitsValid)};
+            valid = _mm_and_si128(valid, digitsValid);
+
+            // Multiply-add (high * 16 + low) of every nibble pair
+            auto words{_mm_maddubs_epi16(nibbles, _mm_set1_epi16(0x0110))};
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(data + index), _mm_packus_epi16(words, words));
+        }
+
+        auto result{_mm_movemask_epi8(valid) == 0xFFFF};
+        return (decodeScalar(text + (2 * index), data + index, dataSize - index) && result);
+    }
+
+    /**
+     * @brief Decode data with AVX2 (32 hex digits per step)
+     *
+     * @param text Pointer to (2 * dataSize) hex digits
+     * @param data Pointer to the data to decode to
+     * @param dataSize Size of the data to decode
+     * @return true Successfully decoded all of the data
+     * @return false Any of the characters is not a hex digit
+     */
+    __attribute__((target("avx2")))
+    bool decodeAvx2(const char* text, HexDataType* data, HexDataSizeType dataSize)
+    {
+        auto valid{_mm256_set1_epi8(-1)};
+        HexDataSizeType index{0};
+        for (; (index + 16) <= dataSize; index += 16)
+        {
+            auto digits{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + (2 * index)))};
+
+            auto digit{_mm256_sub_epi8(digits, _mm256_set1_epi8('0'))};
+            auto isDigit{_mm256_cmpeq_epi8(_mm256_max_epu8(digit, _mm256_set1_epi8(9)), _mm256_set1_epi8(9))};
+            auto letter{_mm256_sub_epi8(_mm256_or_si256(digits, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'))};
+            auto isLetter{_mm256_cmpeq_epi8(_mm256_max_epu8(letter, _mm256_set1_epi8(5)), _mm256_set1_epi8(5))};
+            valid = _mm256_and_si256(valid, _mm256_or_si256(isDigit, isLetter));
+
+            auto nibbles{_mm256_or_si256(_mm256_and_si256(isDigit, digit),
+                _mm256_and_si256(isLetter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))))};
+
+            // Pack within 128-bit lanes and gather the low 64 bits of both lanes
+            auto words{_mm256_maddubs_epi16(nibbles, _mm256_set1_epi16(0x0110))};
+            auto bytes{_mm256_permute4x64_epi64(_mm256_packus_epi16(words, words), 0xD8)};
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(data + index), _mm256_castsi256_si128(bytes));
+        }
+
+        auto result{_mm256_movemask_epi8(valid) == -1};
+        return (decodeSsse3(text + (2 * index), data + index, dataSize - index) && result);
+    }
+
+    /**
+     * @brief Encode data with SSE2 (16 bytes per step)
+     *
+     * @param data Pointer to the data to encode
+     * @param dataSize Size of the data to encode
+     * @param text Pointer to the (2 * dataSize) characters to encode to
+     */
+    __attribute__((target("sse2")))
+    void encodeSse2(const HexDataType* data, HexDataSizeType dataSize, char* text)
+    {
+        HexDataSizeType index{0};
+        for (; (index + 16) <= dataSize; index += 16)
+        {
+            auto bytes{_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index))};
+            auto high{_mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F))};
+            auto low{_mm_and_si128(bytes, _mm_set1_epi8(0x0F))};
+
+            // Nibbles above 9 are shifted from ':' to 'A'
+            auto nibblesLow{_mm_unpacklo_epi8(high, low)};
+            auto nibblesHigh{_mm_unpackhi_epi8(high, low)};
+            auto lettersLow{_mm_and_si128(_mm_cmpgt_epi8(nibblesLow, _mm_set1_epi8(9)), _mm_set1_epi8('A' - '0' - 10))};
+            auto lettersHigh{_mm_and_si128(_mm_cmpgt_epi8(nibblesHigh, _mm_set1_epi8(9)), _mm_set1_epi8('A' - '0' - 10))};
+            auto digitsLow{_mm_add_epi8(_mm_add_epi8(nibblesLow, _mm_set1_epi8('0')), lettersLow)};
+            auto digitsHigh{_mm_add_epi8(_mm_add_epi8(nibblesHigh, _mm_set1_epi8('0')), lettersHigh)};
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(text + (2 * index)), digitsLow);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(text + (2 * index) + 16), digitsHigh);
+        }
+
+        encodeScalar(data + index, dataSize - index, text + (2 * index));
+    }
+
+    /**
+     * @brief Encode data with SSSE3 (16 bytes per step)
+     *
+     * @param data Pointer to the data to encode
+     * @param dataSize Size of the data to encode
+     * @param text Pointer to the (2 * dataSize) characters to encode to
+     */
+    __attribute__((target("ssse3")))
+    void encodeSsse3(const HexDataType* data, HexDataSizeType dataSize, char* text)
+    {
+        const auto digits{_mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F')};
+        HexDataSizeType index{0};
+        for (; (index + 16) <= dataSize; index += 16)
+        {
+            auto bytes{_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index))};
+            auto high{_mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F))};
+            auto low{_mm_and_si128(bytes, _mm_set1_epi8(0x0F))};
+
+            // Look up the digits of all the nibbles at once
+            auto digitsHigh{_mm_shuffle_epi8(digits, high)};
+            auto digitsLow{_mm_shuffle_epi8(digits, low)};
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(text + (2 * index)), _mm_unpacklo_epi8(digitsHigh, digitsLow));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(text + (2 * index) + 16), _mm_unpackhi_epi8(digitsHigh, digitsLow));
+        }
+
+        encodeScalar(data + index, dataSize - index, text + (2 * index));
+    }
+
+    /**
+     * @brief Encode data with AVX2 (32 bytes per step)
+     *
+     * @param data Pointer to the data to encode
+     * @param dataSize Size of the data to encode
+     * @param text Pointer to the (2 * dataSize) characters to encode to
+     */
+    __attribute__((target("avx2")))
+    void encodeAvx2(const HexDataType* data, HexDataSizeType dataSize, char* text)
+    {
+        const auto digits{_mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+            '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F')};
+        HexDataSizeType index{0};
+        for (; (index + 32) <= dataSize; index += 32)
+        {
+            auto bytes{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index))};
+            auto high{_mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0F))};
+            auto low{_mm256_and_si256(bytes, _mm256_set1_epi8(0x0F))};
+
+            auto digitsHigh{_mm256_shuffle_epi8(digits, high)};
+            auto digitsLow{_mm256_shuffle_epi8(digits, low)};
+
+            // Interleave within 128-bit lanes and restore the order of the lanes
+            auto pairsLow{_mm256_unpacklo_epi8(digitsHigh, digitsLow)};
+            auto pairsHigh{_mm256_unpackhi_epi8(digitsHigh, digitsLow)};
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(text + (2 * index)), _mm256_permute2x128_si256(pairsLow, pairsHigh, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(text + (2 * index) + 32), _mm256_permute2x128_si256(pairsLow, pairsHigh, 0x31));
+        }
+
+        encodeSsse3(data + index, dataSize - index, text + (2 * index));
+    }
+#endif
+
+    /**
+     * @brief Get the decode function of the kernel
+     *
+     * @param kernel Kernel
+     * @return DecodeFunction Decode function or nullptr if kernel is not supported
+     */
+    DecodeFunction getDecodeFunction(HexCodecKernelType kernel)
+    {
+        if (!HexCodec::isKernelSupported(kernel))
+            return nullptr;
+
+        switch (kernel)
+        {
+#ifdef LIBIHEX_HEX_CODEC_X86
+            case HexCodecKernelType::KERNEL_SSE2:
+                return decodeSse2;
+                break;
+
+            case HexCodecKernelType::KERNEL_SSSE3:
+                return decodeSsse3;
+                break;
+
+            case HexCodecKernelType::KERNEL_AVX2:
+                return decodeAvx2;
+                break;
+#endif
+
+            case HexCodecKernelType::KERNEL_SCALAR:
+            default:
+                return decodeScalar;
+                break;
+        }
+    }
+
+    /**
+     * @brief Get the encode function of the kernel
+     *
+     * @param kernel Kernel
+     * @return EncodeFunction Encode function or nullptr if kernel is not supported
+     */
+    EncodeFunction getEncodeFunction(HexCodecKernelType kernel)
+    {
+        if (!HexCodec::isKernelSupported(kernel))
+            return nullptr;
+
+        switch (kernel)
+        {
+#ifdef LIBIHEX_HEX_CODEC_X86
+            case HexCodecKernelType::KERNEL_SSE2:
+                return encodeSse2;
+                break;
+
+            case HexCodecKernelType::KERNEL_SSSE3:
+                return encodeSsse3;
+                break;
+
+            case HexCodecKernelType::KERNEL_AVX2:
+                return encodeAvx2;
+                break;
+#endif
+
+            case HexCodecKernelType::KERNEL_SCALAR:
+            default:
+                return encodeScalar;
+                break;
+        }
+    }
+}
+
+bool HexCodec::decodeNibble(char character, HexDataType& value)
+{
+    value = decodeTable[static_cast<unsigned char>(character)];
+    return (value != INVALID_HEX_DIGIT);
+}
+
+bool HexCodec::decodeByte(const char* text, HexDataType& value)
+{
+    auto high{decodeTable[static_cast<unsigned char>(text[0])]};
+    auto low{decodeTable[static_cast<unsigned char>(text[1])]};
+
+    // Any invalid digit has all the upper bits set
+    if ((high | low) & 0xF0)
+        return false;
+
+    value = static_cast<HexDataType>((high << 4) | low);
+    return true;
+}
+
+bool HexCodec::decodeWord(const char* text, uint16_t& value)
+{
+    HexDataType high{0};
+    HexDataType low{0};
+    if (!decodeByte(text, high) || !decodeByte(text + 2, low))
+        return false;
+
+    value = static_cast<uint16_t>((static_cast<uint16_t>(high) << 8) | low);
+    return true;
+}
+
+void HexCodec::encodeByte(HexDataType value, char* text)
+{
+    const auto digits{encodeTable.data() + (2 * value)};
+    text[0] = digits[0];
+    text[1] = digits[1];
+}
+
+void HexCodec::encodeWord(uint16_t value, char* text)
+{
+    encodeByte(static_cast<HexDataType>(value >> 8), text);
+    encodeByte(static_cast<HexDataType>(value & 0xFF), text + 2);
+}
+
+void HexCodec::encode(const HexDataType* data, HexDataSizeType dataSize, char* text)
+{
+    // Kernel is selected only once
+    static const EncodeFunction function{getEncodeFunction(getKernel())};
+    function(data, dataSize, text);
+}
+
+void HexCodec::encode(HexCodecKernelType kernel, const HexDataType* data, HexDataSizeType dataSize, char* text)
+{
+    auto function{getEncodeFunction(kernel)};
+    if (function == nullptr)
+        throw std::domain_error("Kernel is not supported");
+
+    function(data, dataSize, text);
+}
+
+bool HexCodec::decode(const char* text, HexDataType* data, HexDataSizeType dataSize)
+{
+    // Kernel is selected only once
+    static const DecodeFunction function{getDecodeFunction(getKernel())};
+    return function(text, data, dataSize);
+}
+
+bool HexCodec::decode(HexCodecKernelType kernel, const char* text, HexDataType* data, HexDataSizeType dataSize)
+{
+    auto function{getDecodeFunction(kernel)};
+    if (function == nullptr)
+        throw std::domain_error("Kernel is not supported");
+
+    return function(text, data, dataSize);
+}
+
+HexCodecKernelType HexCodec::getKernel()
+{
+    // Select the fastest supported kernel
+    for (auto kernel{static_cast<uint8_t>(HexCodecKernelType::KERNEL_MAX)}; kernel > static_cast<uint8_t>(HexCodecKernelType::KERNEL_MIN); --kernel)
+    {
+        if (isKernelSupported(static_cast<HexCodecKernelType>(kernel)))
+            return static_cast<HexCodecKernelType>(kernel);
+    }
+
+    return HexCodecKernelType::KERNEL_SCALAR;
+}
+
+bool HexCodec::isKernelSupported(HexCodecKernelType kernel)
+{
+    switch (kernel)
+    {
+        case HexCodecKernelType::KERNEL_SCALAR:
+            return true;
+            break;
+
+#ifdef LIBIHEX_HEX_CODEC_X86
+        case HexCodecKernelType::KERNEL_SSE2:
+            return __builtin_cpu_supports("sse2");
+            break;
+
+        case HexCodecKernelType::KERNEL_SSSE3:
+            return __builtin_cpu_supports("ssse3");
+            break;
+
+        case HexCodecKernelType::KERNEL_AVX2:
+            return __builtin_cpu_supports("avx2");
+            break;
+#endif
+
+        default:
+            return false;
+            break;
+    }
+}
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,73 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <ihex/hex_diagnostics.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+HexDiagnostics::HexDiagnostics(size_t maximumErrorCount) :
+    errors{}, errorCount{0}, maximumErrorCount{maximumErrorCount}
+{
+    errors.reserve(maximumErrorCount);
+}
+
+bool HexDiagnostics::pushError(const HexError& error)
+{
+    ++errorCount;
+    if (isFull())
+        return false;
+
+    errors.push_back(error);
+    return true;
+}
+
+const HexErrorVector& HexDiagnostics::getErrors() const
+{
+    return errors;
+}
+
+size_t HexDiagnostics::getErrorCount() const
+{
+    return errorCount;
+}
+
+size_t HexDiagnostics::getMaximumErrorCount() const
+{
+    return maximumErrorCount;
+}
+
+bool HexDiagnostics::isFull() const
+{
+    return (errors.size() >= maximumErrorCount);
+}
+
+bool HexDiagnostics::hasErrors() const
+{
+    return (errorCount > 0);
+}
+
+void HexDiagnostics::clear()
+{
+    errors.clear();
+    errorCount = 0;
+}
+
+END_NAMESPACE_LIBIHEX
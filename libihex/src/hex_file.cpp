@@ -19,111 +19,683 @@
     SPDX-License-Identifier: GPL-3.0-or-later
 */
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
 #include <ihex/hex_file.hpp>
 #include <ihex/hex_group.hpp>
 #include <ihex/hex_section.hpp>
+#include <ihex/hex_visitor.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LIBIHEX_HEX_FILE_POSIX
+#define LIBIHEX_HEX_FILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 BEGIN_NAMESPACE_LIBIHEX
 
-HexFile::HexFile() :
-    HexGroup{}, enableThrowOnInvalidRecord{true}, enableThrowOnChecksumMismatch{true}
+#ifdef LIBIHEX_HEX_FILE_MMAP
+namespace
 {
+    /**
+     * @brief Read-only memory mapping of a regular file
+     *
+     */
+    class MappedFile final
+    {
+        public:
+            /**
+             * @brief Map the file into memory
+             *
+             * @param fileName File name
+             * @note Use isMapped to check if the mapping succeeded
+             */
+            explicit MappedFile(const std::string& fileName) :
+                descriptor{-1}, data{nullptr}, size{0}, mapped{false}
+            {
+                descriptor = ::open(fileName.c_str(), O_RDONLY);
+                if (descriptor < 0)
+                    return;
 
-}
+                // Map regular files only, other files are read as streams
+                struct stat status;
+                if ((::fstat(descriptor, &status) != 0) || !S_ISREG(status.st_mode))
+                    return;
 
-HexFile::~HexFile()
-{
+                size = static_cast<size_t>(status.st_size);
+                if (size == 0)
+                {
+                    mapped = true;
+                    return;
+                }
 
-}
+                auto address{::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0)};
+                if (address == MAP_FAILED)
+                    return;
 
-bool HexFile::load(const std::string& fileName)
-{
-    // Open stream for reading
-    std::ifstream stream{fileName.c_str(), std::ios_base::in};
+                ::madvise(address, size, MADV_SEQUENTIAL);
+                data = static_cast<const char*>(address);
+                mapped = true;
+            }
 
-    // Load data from stream
-    auto result{load(stream)};
+            /**
+             * @brief Unmap and close the file
+             *
+             */
+            ~MappedFile()
+            {
+                if (data != nullptr)
+                    ::munmap(const_cast<char*>(data), size);
 
-    // Close stream and return result
-    stream.close();
-    return result;
+                if (descriptor >= 0)
+                    ::close(descriptor);
+            }
+
+            MappedFile(const MappedFile& file) = delete;
+            MappedFile& operator=(const MappedFile& file) = delete;
+
+            /**
+             * @brief Check if the file is mapped
+             *
+             * @return true File is mapped (empty files have no data)
+             * @return false File is not mapped
+             */
+            bool isMapped() const
+            {
+                return mapped;
+            }
+
+            /**
+             * @brief Get the mapped data
+             *
+             * @return const char* Pointer to the file contents
+             */
+            const char* getData() const
+            {
+                return data;
+            }
+
+            /**
+             * @brief Get the size of the mapped data
+             *
+             * @return size_t Size of the file contents
+             */
+            size_t getSize() const
+            {
+                return size;
+            }
+        protected:
+            /**
+             * @brief File descriptor
+             *
+             */
+            int descriptor;
+
+            /**
+             * @brief Mapped file contents
+             *
+             */
+            const char* data;
+
+            /**
+             * @brief Size of the file contents
+             *
+             */
+            size_t size;
+
+            /**
+             * @brief File mapping status
+             *
+             */
+            bool mapped;
+    };
 }
+#endif
 
-bool HexFile::load(std::istream& stream)
+namespace
 {
-    // Result
-    bool result{stream};
+    /**
+     * @brief Minimum size of the input chunk loaded by a single thread
+     *
+     */
+    constexpr size_t PARALLEL_LOAD_MINIMUM_CHUNK_SIZE{0x4000};
 
-    // Load records while stream is good
-    while (stream)
+    /**
+     * @brief Number of chunks per thread (for load balancing)
+     *
+     */
+    constexpr size_t PARALLEL_LOAD_CHUNKS_PER_THREAD{4};
+
+    /**
+     * @brief Number of records encoded by a single thread at once (chunks are made of whole sections)
+     *
+     */
+    constexpr size_t PARALLEL_SAVE_CHUNK_RECORD_COUNT{0x1000};
+
+    /**
+     * @brief Number of chunks per thread encoded before writing them to a stream
+     *
+     */
+    constexpr size_t PARALLEL_SAVE_CHUNKS_PER_THREAD{4};
+
+    /**
+     * @brief Section parsed from a chunk of input
+     *
+     */
+    struct ParsedSection
     {
-        // Read and load record
-        std::string line;
-        std::getline(stream, line);
+        /**
+         * @brief Record which opened the section
+         *
+         */
+        HexRecord record;
 
-        // Ignore empty lines
-        if (line.size() == 0)
-            continue;
+        /**
+         * @brief Section with all the records of the chunk pushed
+         *
+         */
+        HexSection section;
+
+        /**
+         * @brief Offset of the line with the opening record
+         *
+         */
+        size_t begin;
+
+        /**
+         * @brief Offset of the line following the opening record
+         *
+         */
+        size_t body;
+
+        /**
+         * @brief Index of the line with the opening record (from the start of the chunk)
+         *
+         */
+        size_t line;
+    };
+
+    /**
+     * @brief Chunk of input parsed by a worker thread
+     *
+     */
+    struct ParsedChunk
+    {
+        /**
+         * @brief Offset of the first line of the chunk
+         *
+         */
+        size_t begin;
+
+        /**
+         * @brief Offset past the last line of the chunk
+         *
+         */
+        size_t end;
 
-        // Parse record
+        /**
+         * @brief Offset where parsing stopped (lines from here on are loaded sequentially)
+         *
+         */
+        size_t stop;
+
+        /**
+         * @brief Index of the line where parsing stopped (from the start of the chunk)
+         *
+         */
+        size_t stopLine;
+
+        /**
+         * @brief Offset of the first skipped line (std::string::npos if none)
+         *
+         */
+        size_t skipped;
+
+        /**
+         * @brief Number of lines in the chunk
+         *
+         */
+        size_t lineCount;
+
+        /**
+         * @brief Errors of the skipped lines (line numbers are indices from the start of the chunk)
+         *
+         */
+        HexErrorVector errors;
+
+        /**
+         * @brief Sections in order of their opening records
+         *
+         */
+        std::vector<ParsedSection> sections;
+    };
+
+    /**
+     * @brief Visitor which pushes the invalid records to the diagnostics
+     *
+     */
+    class HexValidator final : public HexVisitor
+    {
+        public:
+            /**
+             * @brief Construct a new HexValidator object
+             *
+             * @param diagnostics Diagnostics to push the errors to
+             */
+            explicit HexValidator(HexDiagnostics& diagnostics) :
+                diagnostics{diagnostics}
+            {
+
+            }
+
+        protected:
+            /**
+             * @brief Push the invalid record to the diagnostics
+             *
+             * @return true Continue the validation
+             * @return false Diagnostics is full
+             */
+            virtual bool onInvalidRecord(std::string_view) override
+            {
+                return pushError(HexErrorType::ERROR_INVALID_RECORD);
+            }
+
+            /**
+             * @brief Push the record with checksum mismatch to the diagnostics
+             *
+             * @return true Continue the validation
+             * @return false Diagnostics is full
+             */
+            virtual bool onChecksumMismatch(std::string_view) override
+            {
+                return pushError(HexErrorType::ERROR_CHECKSUM_MISMATCH);
+            }
+
+            /**
+             * @brief Push the error at the current line to the diagnostics
+             *
+             * @param errorType Type of the error
+             * @return true Continue the validation
+             * @return false Diagnostics is full
+             */
+            bool pushError(HexErrorType errorType)
+            {
+                diagnostics.pushError(HexError{getLineNumber(), getLineOffset(), errorType});
+                return !diagnostics.isFull();
+            }
+
+            /**
+             * @brief Diagnostics to push the errors to
+             *
+             */
+            HexDiagnostics& diagnostics;
+    };
+
+    /**
+     * @brief Get the offset past the end of the line
+     *
+     * @param data Pointer to the data
+     * @param position Offset of the start of the line
+     * @param dataSize Size of the data
+     * @return size_t Offset of the line separator or dataSize
+     */
+    size_t findLineEnd(const char* data, size_t position, size_t dataSize)
+    {
+        auto separator{static_cast<const char*>(std::memchr(data + position, HEX_RECORD_LINE_SEPARATOR, dataSize - position))};
+        return ((separator == nullptr) ? dataSize : static_cast<size_t>(separator - data));
+    }
+
+    /**
+     * @brief Check if the line holds a valid record which always opens a new section
+     *
+     * @param record Record to parse the line to
+     * @param line Line of text
+     * @return true Line holds a valid record other than RECORD_DATA
+     * @return false Line does not hold a valid record or holds a RECORD_DATA record
+     */
+    bool isSectionOpeningLine(HexRecord& record, std::string_view line)
+    {
+        return (record.setRecord(line) && record.isValidChecksum() &&
+            (record.getRecordType() != HexRecordType::RECORD_DATA));
+    }
+
+    /**
+     * @brief Split the data into chunks, which start with a section opening record
+     *
+     * @param data Pointer to the data
+     * @param dataSize Size of the data
+     * @param chunkCount Preferred number of chunks
+     * @return std::vector<ParsedChunk> Chunks covering all of the data
+     */
+    std::vector<ParsedChunk> splitChunks(const char* data, size_t dataSize, size_t chunkCount)
+    {
         HexRecord record;
-        if (!record.setRecord(line))
+        std::vector<size_t> boundaries{0};
+        for (size_t chunk{1}; chunk < chunkCount; ++chunk)
         {
-            if (enableThrowOnInvalidRecord)
-                throw std::runtime_error(std::string("Invalid record found: " + line).c_str());
-            else
+            auto position{std::max((chunk * dataSize) / chunkCount, boundaries.back() + 1)};
+            auto limit{((chunk + 1) * dataSize) / chunkCount};
+            if (position >= dataSize)
+                break;
+
+            // Move to the start of the next line
+            position = findLineEnd(data, position - 1, dataSize) + 1;
+
+            // Find a section opening record before the next preferred split
+            while (position < std::min(limit, dataSize))
             {
-                result = false;
-                continue;
+                auto lineEnd{findLineEnd(data, position, dataSize)};
+                if (isSectionOpeningLine(record, std::string_view{data + position, lineEnd - position}))
+                {
+                    boundaries.push_back(position);
+                    break;
+                }
+                position = lineEnd + 1;
             }
         }
 
-        // Verify record checksum
-        if (!record.isValidChecksum())
+        std::vector<ParsedChunk> result;
+        for (size_t index{0}; index < boundaries.size(); ++index)
         {
-            if (enableThrowOnChecksumMismatch)
-                throw std::logic_error(std::string("Record checksum mismatch found: " + line).c_str());
-            else
+            ParsedChunk chunk{};
+            chunk.begin = boundaries.at(index);
+            chunk.end = (((index + 1) < boundaries.size()) ? boundaries.at(index + 1) : dataSize);
+            chunk.stop = chunk.end;
+            chunk.stopLine = 0;
+            chunk.skipped = std::string::npos;
+            chunk.lineCount = 0;
+            result.push_back(std::move(chunk));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Parse the chunk into sections as the sequential loading would from an empty file
+     *
+     * @param data Pointer to the data
+     * @param chunk Chunk to parse
+     * @param throwOnInvalidRecord Stop parsing on invalid record (instead of skipping it)
+     * @param throwOnChecksumMismatch Stop parsing on record checksum mismatch (instead of skipping it)
+     * @param collectErrors Collect the errors of the skipped lines
+     * @param storageType Storage type of the parsed sections
+     */
+    void parseChunk(const char* data, ParsedChunk& chunk, bool throwOnInvalidRecord, bool throwOnChecksumMismatch, bool collectErrors, HexSectionStorageType storageType)
+    {
+        // Count the lines (including the last one without line separator)
+        chunk.lineCount = static_cast<size_t>(std::count(data + chunk.begin, data + chunk.end, HEX_RECORD_LINE_SEPARATOR));
+        if ((chunk.end > chunk.begin) && (data[chunk.end - 1] != HEX_RECORD_LINE_SEPARATOR))
+            ++chunk.lineCount;
+
+        try
+        {
+            HexRecord record;
+            auto position{chunk.begin};
+            for (size_t lineIndex{0}; position < chunk.end; ++lineIndex)
             {
-                result = false;
-                continue;
+                auto lineEnd{findLineEnd(data, position, chunk.end)};
+                auto next{lineEnd + 1};
+                std::string_view line{data + position, lineEnd - position};
+
+                // Ignore empty lines
+                if (line.size() != 0)
+                {
+                    auto validRecord{record.setRecord(line)};
+                    if (!validRecord || !record.isValidChecksum())
+                    {
+                        // Errors which throw are left to the sequential loading
+                        if (validRecord ? throwOnChecksumMismatch : throwOnInvalidRecord)
+                        {
+                            chunk.stop = position;
+                            chunk.stopLine = lineIndex;
+                            return;
+                        }
+
+                        if (collectErrors)
+                            chunk.errors.push_back(HexError{lineIndex, position, validRecord ? HexErrorType::ERROR_CHECKSUM_MISMATCH : HexErrorType::ERROR_INVALID_RECORD});
+                        chunk.skipped = std::min(chunk.skipped, position);
+                    }
+                    else if ((chunk.sections.size() > 0) && chunk.sections.back().section.canPushRecord(record))
+                        chunk.sections.back().section.pushRecord(record);
+                    else
+                    {
+                        chunk.sections.push_back(ParsedSection{record, HexSection{record}, position, next, lineIndex});
+                        chunk.sections.back().section.setStorageType(storageType);
+                    }
+                }
+
+                position = next;
             }
         }
+        catch (...)
+        {
+            // Leave the whole chunk to the sequential loading
+            chunk.sections.clear();
+            chunk.errors.clear();
+            chunk.stop = chunk.begin;
+            chunk.stopLine = 0;
+            chunk.skipped = std::string::npos;
+        }
+    }
+
+    /**
+     * @brief Chunk of sections encoded by a worker thread
+     *
+     */
+    struct EncodedChunk
+    {
+        /**
+         * @brief Index of the first section of the chunk
+         *
+         */
+        size_t sectionIndex;
+
+        /**
+         * @brief Number of sections in the chunk
+         *
+         */
+        size_t sectionCount;
+
+        /**
+         * @brief Encoded records
+         *
+         */
+        std::string buffer;
 
-        // Create new section if none exist
-        if (getSize() == 0)
+        /**
+         * @brief Exception thrown while encoding (encoded records preceding it are in the buffer)
+         *
+         */
+        std::exception_ptr error;
+    };
+
+    /**
+     * @brief Encode records of a section
+     *
+     * @param section Section to encode
+     * @param recordDataSize Maximum data size of the records (0 yields a record per block)
+     * @param recordAlignment Alignment of the records
+     * @param lineSeparator Line separator
+     * @param text Text to append the records to
+     */
+    void encodeSection(const HexSection& section, HexDataSizeType recordDataSize, HexDataSizeType recordAlignment, const std::string& lineSeparator, std::string& text)
+    {
+        for (auto record{section.begin(recordDataSize, recordAlignment)}; record != section.end(); ++record)
         {
-            HexSection section{record};
-            pushSection(section);
-            continue;
+            record->encode(text);
+            text.append(lineSeparator);
         }
+    }
 
-        auto& section{getSection(getSize() - 1)};
-        if (section.canPushRecord(record))
+    /**
+     * @brief Encode sections of a chunk
+     *
+     * @param group Group of the sections
+     * @param recordDataSize Maximum data size of the records (0 yields a record per block)
+     * @param recordAlignment Alignment of the records
+     * @param lineSeparator Line separator
+     * @param chunk Chunk to encode
+     */
+    void encodeChunk(const HexGroup& group, HexDataSizeType recordDataSize, HexDataSizeType recordAlignment, const std::string& lineSeparator, EncodedChunk& chunk)
+    {
+        try
         {
-            // Push record to the last section
-            section.pushRecord(record);
-            continue;
+            for (auto sectionIndex{chunk.sectionIndex}; sectionIndex < (chunk.sectionIndex + chunk.sectionCount); ++sectionIndex)
+                encodeSection(group.getSection(sectionIndex), recordDataSize, recordAlignment, lineSeparator, chunk.buffer);
         }
-        else
+        catch (...)
         {
-            // If record can not be pushed to
-            // the last section, create
-            // a new section
-            HexSection newSection{record};
-            pushSection(newSection);
-            continue;
+            chunk.error = std::current_exception();
         }
     }
 
+    /**
+     * @brief Resolve the number of threads
+     *
+     * @param threadCount Number of threads (0 uses all hardware threads)
+     * @return size_t Number of threads (at least 1)
+     */
+    size_t resolveThreadCount(size_t threadCount)
+    {
+        if (threadCount == 0)
+            return std::max(std::thread::hardware_concurrency(), 1U);
+
+        return threadCount;
+    }
+}
+
+HexFile::HexFile() :
+    HexFile{allocator_type{}}
+{
+
+}
+
+HexFile::HexFile(const allocator_type& allocator) :
+    HexGroup{allocator}, enableThrowOnInvalidRecord{true}, enableThrowOnChecksumMismatch{true}, threadCount{1},
+    lineSeparator(1, HEX_RECORD_LINE_SEPARATOR), recordDataSize{0}, recordAlignment{0},
+    enableSaveCache{false}, saveCache{}, diagnostics{}, lineNumber{0}, lineOffset{0}, nextLineOffset{0}
+{
+
+}
+
+HexFile::~HexFile()
+{
+
+}
+
+bool HexFile::load(const std::string& fileName)
+{
+#ifdef LIBIHEX_HEX_FILE_MMAP
+    // Map regular files into memory and parse them in place
+    MappedFile file{fileName};
+    if (file.isMapped())
+        return load(file.getData(), file.getSize());
+#endif
+
+    // Open stream for reading
+    std::ifstream stream{fileName.c_str(), std::ios_base::in};
+
+    // Load data from stream
+    auto result{load(stream)};
+
+    // Close stream and return result
+    stream.close();
+    return result;
+}
+
+bool HexFile::load(std::istream& stream)
+{
+    // Result
+    bool result{stream};
+    resetLinePosition();
+
+    // Load records while stream is good
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        // Load record
+        if (!loadLine(line))
+            result = false;
+    }
+
     // Return result
     return result;
 }
 
+bool HexFile::load(const char* data, size_t dataSize)
+{
+    resetLinePosition();
+
+    // Resolve the number of threads
+    auto threads{resolveThreadCount(threadCount)};
+
+    // Load large inputs in parallel
+    if ((threads > 1) && (dataSize >= (2 * PARALLEL_LOAD_MINIMUM_CHUNK_SIZE)))
+        return loadParallel(data, dataSize, threads);
+
+    return loadLines(data, dataSize);
+}
+
+bool HexFile::validate(const std::string& fileName, HexDiagnostics& diagnostics)
+{
+    HexValidator validator{diagnostics};
+
+#ifdef LIBIHEX_HEX_FILE_MMAP
+    // Map regular files into memory and validate them in place
+    MappedFile file{fileName};
+    if (file.isMapped())
+        return validator.visit(file.getData(), file.getSize());
+#endif
+
+    return validator.visit(fileName);
+}
+
+bool HexFile::validate(std::istream& stream, HexDiagnostics& diagnostics)
+{
+    HexValidator validator{diagnostics};
+    return validator.visit(stream);
+}
+
+bool HexFile::validate(const char* data, size_t dataSize, HexDiagnostics& diagnostics)
+{
+    HexValidator validator{diagnostics};
+    return validator.visit(data, dataSize);
+}
+
 bool HexFile::save(const std::string& fileName)
 {
+#if defined(LIBIHEX_HEX_FILE_POSIX) && defined(LIBIHEX_HEX_SINK_DESCRIPTOR)
+    // Open file for writing and truncate existing contents
+    auto descriptor{::open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666)};
+    if (descriptor < 0)
+        return false;
+
+    // Save data to file descriptor, which is closed on errors too
+    bool result{false};
+    try
+    {
+        HexFileDescriptorSink sink{descriptor};
+        result = save(sink);
+    }
+    catch (...)
+    {
+        ::close(descriptor);
+        throw;
+    }
+
+    // Close file and return result
+    return ((::close(descriptor) == 0) && result);
+#else
     // Open stream for writing and truncate existing contents
     std::ofstream stream{fileName.c_str(), std::ios_base::out};
 
@@ -133,25 +705,121 @@ bool HexFile::save(const std::string& fileName)
     // Close stream and return result
     stream.close();
     return result;
+#endif
 }
 
 bool HexFile::save(std::ostream& stream)
 {
-    // Write sections sequentially to a stream
-    for (size_t sectionIndex{0}; sectionIndex < getSize(); sectionIndex++)
+    HexStreamSink sink{stream};
+    return save(sink);
+}
+
+bool HexFile::save(HexSink& sink)
+{
+    // Sections are only read, so they are not referenced for changes
+    const HexGroup& group{*this};
+
+    // Reuse the encoded sections, which were not modified
+    auto threads{resolveThreadCount(threadCount)};
+    if (enableSaveCache)
+        return saveCached(sink, threads);
+
+    // Save large groups in parallel
+    if (threads > 1)
+    {
+        size_t recordCount{0};
+        for (size_t sectionIndex{0}; sectionIndex < group.getSize(); sectionIndex++)
+            recordCount += group.getSection(sectionIndex).getSize();
+
+        if (recordCount >= (2 * PARALLEL_SAVE_CHUNK_RECORD_COUNT))
+            return saveParallel(sink, threads);
+    }
+
+    // Write sections sequentially to a sink
+    for (size_t sectionIndex{0}; sectionIndex < group.getSize(); sectionIndex++)
     {
         // Iterate through all the records
-        const HexSection& section{getSection(sectionIndex)};
-        for (size_t recordIndex{0}; recordIndex < section.getSize(); recordIndex++)
+        const HexSection& section{group.getSection(sectionIndex)};
+        for (auto record{section.begin(recordDataSize, recordAlignment)}; record != section.end(); ++record)
         {
-            // Write every individual record to a stream
-            std::string record;
-            stream << section.getRecord(recordIndex).getRecord() << HEX_RECORD_LINE_SEPARATOR;
+            // Encode every individual record directly to the sink buffer
+            auto length{record->getRecordLength()};
+            auto text{sink.prepare(length + lineSeparator.size())};
+            if (text == nullptr)
+                return false;
+
+            record->encode(text);
+            std::memcpy(text + length, lineSeparator.data(), lineSeparator.size());
+            sink.commit(length + lineSeparator.size());
         }
     }
 
-    // Return stream status
-    return bool(stream);
+    // Flush the remaining records to a sink
+    return sink.flush();
+}
+
+bool HexFile::saveParallel(HexSink& sink, size_t threadCount)
+{
+    const HexGroup& group{*this};
+    std::vector<EncodedChunk> chunks(threadCount * PARALLEL_SAVE_CHUNKS_PER_THREAD);
+
+    size_t sectionIndex{0};
+    while (sectionIndex < group.getSize())
+    {
+        // Split the following sections into chunks by their record counts
+        size_t chunkCount{0};
+        for (; (chunkCount < chunks.size()) && (sectionIndex < group.getSize()); ++chunkCount)
+        {
+            auto& chunk{chunks.at(chunkCount)};
+            chunk.sectionIndex = sectionIndex;
+            chunk.sectionCount = 0;
+            chunk.buffer.clear();
+            chunk.error = nullptr;
+
+            for (size_t recordCount{0}; (recordCount < PARALLEL_SAVE_CHUNK_RECORD_COUNT) && (sectionIndex < group.getSize()); ++sectionIndex, ++chunk.sectionCount)
+                recordCount += group.getSection(sectionIndex).getSize();
+        }
+
+        // Encode the chunks on the worker threads and the calling thread
+        std::atomic<size_t> nextChunk{0};
+        auto worker{[&]()
+        {
+            for (auto index{nextChunk.fetch_add(1)}; index < chunkCount; index = nextChunk.fetch_add(1))
+                encodeChunk(group, recordDataSize, recordAlignment, lineSeparator, chunks.at(index));
+        }};
+
+        std::vector<std::thread> workers;
+        for (size_t index{1}; index < std::min(threadCount, chunkCount); ++index)
+        {
+            try
+            {
+                workers.emplace_back(worker);
+            }
+            catch (const std::system_error&)
+            {
+                // Continue with the threads started so far
+                break;
+            }
+        }
+
+        worker();
+        for (auto& thread : workers)
+            thread.join();
+
+        // Write the chunks in order
+        for (size_t index{0}; index < chunkCount; ++index)
+        {
+            const auto& chunk{chunks.at(index)};
+            if (!sink.write(chunk.buffer.data(), chunk.buffer.size()))
+                return false;
+
+            if (chunk.error)
+                std::rethrow_exception(chunk.error);
+        }
+    }
+
+    // Flush the remaining records to a sink
+    return sink.flush();
 }
 
 bool HexFile::getThrowOnInvalidRecord()
@@ -174,4 +842,419 @@ void HexFile::setThrowOnChecksumMismatch(bool enableThrowOnChecksumMismatch)
     this->enableThrowOnChecksumMismatch = enableThrowOnChecksumMismatch;
 }
 
+HexDataSizeType HexFile::getRecordDataSize()
+{
+    return recordDataSize;
+}
+
+void HexFile::setRecordDataSize(HexDataSizeType recordDataSize)
+{
+    if (recordDataSize > MAXIMUM_HEX_RECORD_DATA_SIZE)
+        throw std::out_of_range("Record data size is out of range");
+
+    this->recordDataSize = recordDataSize;
+    clearSaveCache();
+}
+
+HexDataSizeType HexFile::getRecordAlignment()
+{
+    return recordAlignment;
+}
+
+void HexFile::setRecordAlignment(HexDataSizeType recordAlignment)
+{
+    this->recordAlignment = recordAlignment;
+    clearSaveCache();
+}
+
+bool HexFile::saveCached(HexSink& sink, size_t threadCount)
+{
+    const HexGroup& group{*this};
+
+    // Take over the cached text of the unmodified sections (copies of a section share its text)
+    std::unordered_map<uint64_t, std::string> cache;
+    std::vector<size_t> modified;
+    for (size_t sectionIndex{0}; sectionIndex < group.getSize(); sectionIndex++)
+    {
+        auto revision{group.getSection(sectionIndex).getRevision()};
+        if (cache.count(revision) > 0)
+            continue;
+
+        auto node{saveCache.extract(revision)};
+        if (node)
+        {
+            cache.insert(std::move(node));
+        }
+        else
+        {
+            cache.emplace(revision, std::string{});
+            modified.push_back(sectionIndex);
+        }
+    }
+
+    // Encode the modified sections on the worker threads and the calling thread
+    std::vector<std::exception_ptr> errors(group.getSize());
+    std::atomic<size_t> nextSection{0};
+    auto worker{[&]()
+    {
+        for (auto index{nextSection.fetch_add(1)}; index < modified.size(); index = nextSection.fetch_add(1))
+        {
+            const auto sectionIndex{modified.at(index)};
+            const auto& section{group.getSection(sectionIndex)};
+            try
+            {
+                encodeSection(section, recordDataSize, recordAlignment, lineSeparator, cache.at(section.getRevision()));
+            }
+            catch (...)
+            {
+                errors.at(sectionIndex) = std::current_exception();
+            }
+        }
+    }};
+
+    std::vector<std::thread> workers;
+    for (size_t index{1}; index < std::min(threadCount, modified.size()); ++index)
+    {
+        try
+        {
+            workers.emplace_back(worker);
+        }
+        catch (const std::system_error&)
+        {
+            // Continue with the threads started so far
+            break;
+        }
+    }
+
+    worker();
+    for (auto& thread : workers)
+        thread.join();
+
+    // Write the sections in order
+    for (size_t sectionIndex{0}; sectionIndex < group.getSize(); sectionIndex++)
+    {
+        const auto& text{cache.at(group.getSection(sectionIndex).getRevision())};
+        if (!sink.write(text.data(), text.size()))
+            return false;
+
+        if (errors.at(sectionIndex))
+            std::rethrow_exception(errors.at(sectionIndex));
+    }
+
+    // Keep the text of the current sections only, except for the sections
+    // with referenced data which may be written without changing their revision
+    for (size_t sectionIndex{0}; sectionIndex < group.getSize(); sectionIndex++)
+    {
+        const auto& section{group.getSection(sectionIndex)};
+        if (section.isDataReferenced())
+            cache.erase(section.getRevision());
+    }
+
+    saveCache.swap(cache);
+    return sink.flush();
+}
+
+std::string HexFile::getLineSeparator()
+{
+    return lineSeparator;
+}
+
+bool HexFile::getSaveCache()
+{
+    return enableSaveCache;
+}
+
+void HexFile::setSaveCache(bool enableSaveCache)
+{
+    this->enableSaveCache = enableSaveCache;
+    if (!enableSaveCache)
+        clearSaveCache();
+}
+
+void HexFile::clearSaveCache()
+{
+    saveCache.clear();
+}
+
+size_t HexFile::getSaveCacheSize()
+{
+    size_t result{0};
+    for (const auto& entry : saveCache)
+        result += entry.second.size();
+
+    return result;
+}
+
+void HexFile::setLineSeparator(const std::string& lineSeparator)
+{
+    if (lineSeparator.empty())
+        throw std::invalid_argument("Line separator must not be empty");
+
+    this->lineSeparator = lineSeparator;
+    clearSaveCache();
+}
+
+size_t HexFile::getThreadCount()
+{
+    return threadCount;
+}
+
+void HexFile::setThreadCount(size_t threadCount)
+{
+    this->threadCount = threadCount;
+}
+
+HexDiagnosticsPtr HexFile::getDiagnostics()
+{
+    return diagnostics;
+}
+
+void HexFile::setDiagnostics(HexDiagnosticsPtr diagnostics)
+{
+    this->diagnostics = diagnostics;
+}
+
+bool HexFile::loadLine(std::string_view line)
+{
+    return loadLine(line, line.size() + 1);
+}
+
+bool HexFile::loadLine(std::string_view line, size_t lineSize)
+{
+    // Advance the line position
+    ++lineNumber;
+    lineOffset = nextLineOffset;
+    nextLineOffset += lineSize;
+
+    // Ignore empty lines
+    if (line.size() == 0)
+        return true;
+
+    // Parse record
+    HexRecord record;
+    if (!record.setRecord(line))
+        return reportError(HexErrorType::ERROR_INVALID_RECORD, line);
+
+    // Verify record checksum
+    if (!record.isValidChecksum())
+        return reportError(HexErrorType::ERROR_CHECKSUM_MISMATCH, line);
+
+    // Create new section if none exist
+    if (getSize() == 0)
+    {
+        HexSection section{record};
+        if (pushSection(section) == std::string::npos)
+            return reportError(HexErrorType::ERROR_REJECTED_RECORD, line);
+        return true;
+    }
+
+    auto& section{sections.back()};
+    if (section.canPushRecord(record))
+    {
+        // Push record to the last section
+        section.pushRecord(record);
+
+        // Only non-data records can change the type of the last section
+        if (record.getRecordType() != HexRecordType::RECORD_DATA)
+            rebuildAddressRanges();
+    }
+    else
+    {
+        // If record can not be pushed to
+        // the last section, create
+        // a new section
+        HexSection newSection{record};
+        if (pushSection(newSection) == std::string::npos)
+            return reportError(HexErrorType::ERROR_REJECTED_RECORD, line);
+    }
+
+    return true;
+}
+
+size_t HexFile::getLineNumber()
+{
+    return lineNumber;
+}
+
+size_t HexFile::getLineOffset()
+{
+    return lineOffset;
+}
+
+void HexFile::resetLinePosition()
+{
+    lineNumber = 0;
+    lineOffset = 0;
+    nextLineOffset = 0;
+}
+
+bool HexFile::reportError(HexErrorType errorType, std::string_view line)
+{
+    // Collect the error instead of throwing
+    if (diagnostics)
+    {
+        diagnostics->pushError(HexError{lineNumber, lineOffset, errorType});
+        return false;
+    }
+
+    switch (errorType)
+    {
+        case HexErrorType::ERROR_INVALID_RECORD:
+            if (enableThrowOnInvalidRecord)
+                throw std::runtime_error("Invalid record found: " + std::string{line});
+            break;
+
+        case HexErrorType::ERROR_CHECKSUM_MISMATCH:
+            if (enableThrowOnChecksumMismatch)
+                throw std::logic_error("Record checksum mismatch found: " + std::string{line});
+            break;
+
+        case HexErrorType::ERROR_REJECTED_RECORD:
+        default:
+            // Rejected records are only reported to the diagnostics
+            return true;
+            break;
+    }
+
+    return false;
+}
+
+bool HexFile::loadLines(const char* data, size_t dataSize)
+{
+    // Result
+    bool result{true};
+
+    // Load every line in place
+    size_t position{0};
+    while (position < dataSize)
+    {
+        auto lineEnd{findLineEnd(data, position, dataSize)};
+        if (!loadLine(std::string_view{data + position, lineEnd - position}, std::min(lineEnd + 1, dataSize) - position))
+            result = false;
+
+        position = lineEnd + 1;
+    }
+
+    // Return result
+    return result;
+}
+
+bool HexFile::loadParallel(const char* data, size_t dataSize, size_t threadCount)
+{
+    // Split the input into chunks starting with section opening records
+    auto chunkCount{std::min(threadCount * PARALLEL_LOAD_CHUNKS_PER_THREAD, dataSize / PARALLEL_LOAD_MINIMUM_CHUNK_SIZE)};
+    auto chunks{splitChunks(data, dataSize, chunkCount)};
+    if (chunks.size() < 2)
+        return loadLines(data, dataSize);
+
+    // Parse the chunks on the worker threads and the calling thread
+    const auto storageType{getSectionStorageType()};
+    std::atomic<size_t> nextChunk{0};
+    auto worker{[&]()
+    {
+        for (auto index{nextChunk.fetch_add(1)}; index < chunks.size(); index = nextChunk.fetch_add(1))
+            parseChunk(data, chunks.at(index), enableThrowOnInvalidRecord && !diagnostics, enableThrowOnChecksumMismatch && !diagnostics, bool(diagnostics), storageType);
+    }};
+
+    std::vector<std::thread> workers;
+    for (size_t index{1}; index < std::min(threadCount, chunks.size()); ++index)
+    {
+        try
+        {
+            workers.emplace_back(worker);
+        }
+        catch (const std::system_error&)
+        {
+            // Continue with the threads started so far
+            break;
+        }
+    }
+
+    worker();
+    for (auto& thread : workers)
+        thread.join();
+
+    // Merge the chunks in order
+    bool result{true};
+    size_t lineBase{0};
+    for (auto& chunk : chunks)
+    {
+        // Push the errors found by the worker before the offset
+        size_t errorIndex{0};
+        auto pushErrors{[&](size_t offset)
+        {
+            for (; (errorIndex < chunk.errors.size()) && (chunk.errors.at(errorIndex).offset < offset); ++errorIndex)
+            {
+                auto error{chunk.errors.at(errorIndex)};
+                error.line += (lineBase + 1);
+                diagnostics->pushError(error);
+            }
+        }};
+
+        // Load the lines from the offset sequentially
+        auto loadRemaining{[&](size_t offset, size_t line)
+        {
+            pushErrors(offset);
+            lineNumber = lineBase + line;
+            nextLineOffset = offset;
+            return loadLines(data + offset, chunk.end - offset);
+        }};
+
+        bool merged{true};
+        for (auto& parsed : chunk.sections)
+        {
+            // Opening record would be pushed to the last section, load the rest sequentially
+            if ((getSize() > 0) && sections.back().canPushRecord(parsed.record))
+            {
+                result = (chunk.skipped > parsed.begin) && result;
+                result = loadRemaining(parsed.begin, parsed.line) && result;
+                merged = false;
+                break;
+            }
+
+            // Push the opening section the same way as the sequential loading does
+            auto index{getSize()};
+            auto pushedIndex{pushSection(HexSection{parsed.record})};
+            if (pushedIndex != index)
+            {
+                // Section was rejected or was not pushed as the last one,
+                // so the following records end up elsewhere
+                if (pushedIndex == std::string::npos)
+                {
+                    pushErrors(parsed.begin);
+                    lineNumber = lineBase + parsed.line + 1;
+                    lineOffset = parsed.begin;
+                    result = reportError(HexErrorType::ERROR_REJECTED_RECORD, std::string_view{data + parsed.begin, parsed.body - parsed.begin}) && result;
+                }
+
+                result = (chunk.skipped > parsed.body) && result;
+                result = loadRemaining(parsed.body, parsed.line + 1) && result;
+                merged = false;
+                break;
+            }
+
+            // Replace the opening section with the fully parsed one (of the same address)
+            auto& section{sections.at(index)};
+            section = std::move(parsed.section);
+            section.setUnusedDataFillValue(getUnusedDataFillValue());
+        }
+
+        if (merged)
+        {
+            result = (chunk.skipped == std::string::npos) && result;
+
+            // Load the lines left by the worker (throws if enabled)
+            if (chunk.stop < chunk.end)
+                result = loadRemaining(chunk.stop, chunk.stopLine) && result;
+            else
+                pushErrors(chunk.end);
+        }
+
+        lineBase += chunk.lineCount;
+    }
+
+    lineNumber = lineBase;
+    return result;
+}
+
 END_NAMESPACE_LIBIHEX
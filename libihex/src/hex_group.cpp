@@ -20,6 +20,7 @@
 */
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <limits>
 #include <stdexcept>
@@ -33,22 +34,89 @@
 BEGIN_NAMESPACE_LIBIHEX
 
 HexGroup::HexGroup() :
-    sections{}, unusedDataFillValue(DEFAULT_HEX_RECORD_DATA_VALUE)
+    HexGroup{allocator_type{}}
 {
 
 }
 
+HexGroup::HexGroup(const allocator_type& allocator) :
+    sections{allocator}, unusedDataFillValue(DEFAULT_HEX_RECORD_DATA_VALUE), sectionStorageType{HexSectionStorageType::STORAGE_BLOCKS},
+    addressRanges{allocator}, groupType{HexAddressEnumType::ADDRESS_I8HEX}, sectionReferences{allocator}, referencedSections{allocator}, addressCursor{0}
+{
+
+}
+
+HexGroup::HexGroup(const HexGroup& group) :
+    sections{group.sections}, unusedDataFillValue{group.unusedDataFillValue}, sectionStorageType{group.sectionStorageType},
+    addressRanges{group.addressRanges}, groupType{group.groupType}, sectionReferences{}, referencedSections{}, addressCursor{0}
+{
+    // Sections of the copy are not referenced, but the copied ranges may be out of date
+    if (!group.hasValidAddressRanges())
+        rebuildAddressRanges();
+}
+
+HexGroup::HexGroup(HexGroup&& group) :
+    sections{std::move(group.sections)}, unusedDataFillValue{group.unusedDataFillValue}, sectionStorageType{group.sectionStorageType},
+    addressRanges{std::move(group.addressRanges)}, groupType{group.groupType}, sectionReferences{std::move(group.sectionReferences)}, referencedSections{std::move(group.referencedSections)},
+    addressCursor{0}
+{
+    // Moved-from group rebuilds its ranges from whatever sections are left
+    group.sectionReferences.clear();
+    group.referencedSections.clear();
+    group.rebuildAddressRanges();
+}
+
+HexGroup& HexGroup::operator=(const HexGroup& group)
+{
+    if (this != &group)
+    {
+        // References to the sections of this group now refer to the copied sections
+        sections = group.sections;
+        unusedDataFillValue = group.unusedDataFillValue;
+        sectionStorageType = group.sectionStorageType;
+        rebuildAddressRanges();
+    }
+
+    return *this;
+}
+
+HexGroup& HexGroup::operator=(HexGroup&& group)
+{
+    if (this != &group)
+    {
+        // References to the sections of the moved group now refer to the sections of this group
+        sections = std::move(group.sections);
+        unusedDataFillValue = group.unusedDataFillValue;
+        sectionStorageType = group.sectionStorageType;
+        sectionReferences = std::move(group.sectionReferences);
+        referencedSections = std::move(group.referencedSections);
+        rebuildAddressRanges();
+        group.sectionReferences.clear();
+        group.referencedSections.clear();
+        group.rebuildAddressRanges();
+    }
+
+    return *this;
+}
+
 HexGroup::~HexGroup()
 {
 
 }
 
+HexGroup::allocator_type HexGroup::get_allocator() const
+{
+    return sections.get_allocator();
+}
+
 HexDataType HexGroup::operator[](HexAddressType address) const
 {
-    // Iterate through all the sections to find the data
-    for (const auto& sect : sections)
+    // Find the section with the data
+    const auto index{findSection(address)};
+    if (index != std::string::npos)
     {
-        if (sect.hasData() && sect.hasAbsoluteAddress(address))
+        const auto& sect{sections.at(index)};
+        if (sect.hasData())
             return sect[sect.getRelativeAddress(address)];
     }
 
@@ -58,10 +126,12 @@ HexDataType HexGroup::operator[](HexAddressType address) const
 
 HexDataType& HexGroup::operator[](HexAddressType address)
 {
-    // Iterate through all the sections to find the data
-    for (auto& sect : sections)
+    // Find the section with the data
+    const auto index{findSection(address)};
+    if (index != std::string::npos)
     {
-        if (sect.hasData() && sect.hasAbsoluteAddress(address))
+        auto& sect{sections.at(index)};
+        if (sect.hasData())
             return sect[sect.getRelativeAddress(address)];
     }
 
@@ -81,23 +151,22 @@ const HexSection& HexGroup::getSection(size_t index) const
 
 HexSection& HexGroup::getSection(size_t index)
 {
-    return sections.at(index);
+    return referenceSection(index);
 }
 
-size_t HexGroup::findSection(HexAddressType address) const
+size_t HexGroup::getReferencedSectionCount() const
 {
-    // Iterate through all the sections to find the address
-    for (size_t index{0}; index < sections.size(); ++index)
-    {
-        // Continue if section does not have addresses
-        const auto& sect{sections.at(index)};
-        if (!sect.hasAddress())
-            continue;
+    return sectionReferences.size();
+}
 
-        // Return the index of the section containing the address
-        if (sect.hasAbsoluteAddress(address))
-            return index;
-    }
+size_t HexGroup::findSection(HexAddressType address) const
+{
+    // Range containing the address
+    HexAddressRangeVector rebuiltRanges{sections.get_allocator()};
+    const auto& ranges{getAddressRanges(rebuiltRanges)};
+    const auto it{findAddressRange(ranges, address)};
+    if ((it != ranges.cend()) && (it->address <= address))
+        return it->index;
 
     // Return if no section exist with the address
     return std::string::npos;
@@ -105,42 +174,28 @@ size_t HexGroup::findSection(HexAddressType address) const
 
 size_t HexGroup::findPreviousSection(HexAddressType address) const
 {
-    // Define result and build address map
-    size_t result{std::string::npos};
-    HexAddressMap map{getAddressMap()};
-
-    // Find section which is lower by address than the provided address
-    for (auto it{map.cbegin()}; it != map.cend(); ++it)
-    {
-        // Find section through the ordered address map with the last
-        // lower address than the one provided by the parameter address
-        if (address > (it->first + it->second - 1))
-            result = findSection(it->first);
-        else
-            break;
-    }
-
-    return result;
+    // Range before the range containing the address (or the range after the address)
+    HexAddressRangeVector rebuiltRanges{sections.get_allocator()};
+    const auto& ranges{getAddressRanges(rebuiltRanges)};
+    const auto it{findAddressRange(ranges, address)};
+    if (it != ranges.cbegin())
+        return std::prev(it)->index;
+
+    // Return if no previous section exist
+    return std::string::npos;
 }
 
 size_t HexGroup::findNextSection(HexAddressType address) const
 {
-    // Define result and build address map
-    size_t result{std::string::npos};
-    HexAddressMap map{getAddressMap()};
-
-    // Find section which is higher by address than the provided address
-    for (auto it{map.crbegin()}; it != map.crend(); ++it)
-    {
-        // Find section through the ordered address map with the last
-        // higher address than the one provided by the parameter address
-        if (address < it->first)
-            result = findSection(it->first);
-        else
-            break;
-    }
-
-    return result;
+    // Range starting after the address
+    HexAddressRangeVector rebuiltRanges{sections.get_allocator()};
+    const auto& ranges{getAddressRanges(rebuiltRanges)};
+    const auto it{std::upper_bound(ranges.cbegin(), ranges.cend(), HexAddressRange{address, 0, 0})};
+    if (it != ranges.cend())
+        return it->index;
+
+    // Return if no next section exist
+    return std::string::npos;
 }
 
 size_t HexGroup::checkIntersect(HexAddressEnumType type, const HexSection& section) const
@@ -274,22 +329,15 @@ size_t HexGroup::createSection(HexAddressEnumType type, HexAddressType address)
             // Find the extended linear address that fits the absolute address
             const auto linearAddress{HexAddress::findExtendedLinearAddress(address)};
 
+            // Section that already has the address intersects with the newly created section,
+            // so we do not push the section and just return the existing section index
+            const auto sectionIndex{findSection(address)};
+            if (sectionIndex != std::string::npos)
+                return sectionIndex;
+
             // Create a new section that includes the new address
             HexSection section{HexRecord::makeExtendedLinearAddressRecord(linearAddress)};
 
-            // Check that none of the existing sections intersect with the new section
-            for (size_t index{0}; index < sections.size(); ++index)
-            {
-                const auto& sect{sections.at(index)};
-                if (sect.getSectionType() == HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS)
-                {
-                    // Section that intersects with the newly created section, already has the address
-                    // so we do not push the section and just return the existing section index
-                    if (sect.checkIntersect(section))
-                        return index;
-                }
-            }
-
             // If no existing sections have the absolute address that we want,
             // push the new section
             return pushSection(section);
@@ -354,7 +402,7 @@ size_t HexGroup::createSection(HexAddressEnumType type, HexAddressType address,
                 if (sectionIndex != std::string::npos)
                 {
                     // Find section
-                    const auto sect{getSection(sectionIndex)};
+                    const auto& sect{sections.at(sectionIndex)};
 
                     // Calculate next address
                     const auto next{static_cast<HexDataSizeType>(std::min(last, sect.getMaxAbsoluteAddress()) + 1)};
@@ -522,9 +570,22 @@ void HexGroup::removeSection(size_t index)
 {
     if ((sections.size() > 0) && (index < sections.size()))
     {
+        updateAddressRanges();
+
         auto it{sections.cbegin()};
         std::advance(it, index);
-        sections.erase(it);
+        eraseSection(it);
+
+        // Remove the ranges of the section and shift the following sections
+        addressRanges.erase(std::remove_if(addressRanges.begin(), addressRanges.end(),
+            [index](const HexAddressRange& range) { return (range.index == index); }), addressRanges.end());
+        for (auto& range : addressRanges)
+        {
+            if (range.index > index)
+                --range.index;
+        }
+        groupType = findGroupType();
+        addressCursor.store(0, std::memory_order_relaxed);
     }
     else
         throw std::out_of_range("Section index is out of range");
@@ -533,6 +594,9 @@ void HexGroup::removeSection(size_t index)
 void HexGroup::clearSections()
 {
     sections.clear();
+    sectionReferences.clear();
+    referencedSections.clear();
+    rebuildAddressRanges();
 }
 
 bool HexGroup::canPushSection(const HexSection& section, size_t& index) const
@@ -701,10 +765,16 @@ size_t HexGroup::pushSection(const HexSection& section)
 
     if (result)
     {
+        updateAddressRanges();
+
+        // Inserting the section invalidates the references at and after its index,
+        // or all of them if the sections are reallocated
+        const auto capacity{sections.capacity()};
         if (index >= sections.size())
         {
             sections.push_back(section);
             sections.back().setUnusedDataFillValue(unusedDataFillValue);
+            sections.back().setStorageType(sectionStorageType);
         }
         else
         {
@@ -712,7 +782,26 @@ size_t HexGroup::pushSection(const HexSection& section)
             std::advance(it, index);
             sections.insert(it, section);
             sections.at(index).setUnusedDataFillValue(unusedDataFillValue);
+            sections.at(index).setStorageType(sectionStorageType);
+        }
+
+        dropSectionReferences((sections.capacity() != capacity) ? 0 : index);
+
+        // Shift the following sections and add the ranges of the section
+        for (auto& range : addressRanges)
+        {
+            if (range.index >= index)
+                ++range.index;
         }
+
+        const auto middle{static_cast<std::ptrdiff_t>(addressRanges.size())};
+        appendAddressRanges(addressRanges, index);
+        std::inplace_merge(addressRanges.begin(), std::next(addressRanges.begin(), middle), addressRanges.end());
+
+        // Only the first typed section determines the group type
+        if (groupType == HexAddressEnumType::ADDRESS_I8HEX)
+            groupType = findGroupType();
+        addressCursor.store(0, std::memory_order_relaxed);
     }
 
     return index;
@@ -720,14 +809,11 @@ size_t HexGroup::pushSection(const HexSection& section)
 
 HexAddressMap HexGroup::getAddressMap() const
 {
-    // Iterate through all the sections
+    // Copy all the address ranges
+    HexAddressRangeVector rebuiltRanges{sections.get_allocator()};
     HexAddressMap result{};
-    for (const auto& sect : sections)
-    {
-        // Add mapping of the data sections only
-        if (sect.hasAddress())
-            result.merge(sect.getAddressMap());
-    }
+    for (const auto& range : getAddressRanges(rebuiltRanges))
+        result.emplace(range.address, range.size);
 
     // Return address map
     return result;
@@ -754,10 +840,12 @@ void HexGroup::clearData()
     for (auto it{sections.begin()}; it != sections.end();)
     {
         if (it->hasAddress())
-            it = sections.erase(it);
+            it = eraseSection(it);
         else
             ++it;
     }
+
+    rebuildAddressRanges();
 }
 
 void HexGroup::clearData(HexAddressType address)
@@ -766,10 +854,12 @@ void HexGroup::clearData(HexAddressType address)
     if (!HexAddress::isValidAbsoluteAddress(getGroupType(), address))
         throw std::out_of_range("Absolute address is out of range for the current group type");
 
-    // Iterate through all the sections to find the data
-    for (auto& sect : sections)
+    // Find the section with the data
+    const auto index{findSection(address)};
+    if (index != std::string::npos)
     {
-        if (sect.hasData() && sect.hasAbsoluteAddress(address))
+        auto& sect{sections.at(index)};
+        if (sect.hasData())
             sect.clearData(sect.getRelativeAddress(address));
     }
 }
@@ -780,38 +870,28 @@ HexDataSizeType HexGroup::clearData(HexAddressType address, HexDataSizeType data
     if (!HexAddress::isValidAbsoluteAddressRange(getGroupType(), address, dataSize))
         throw std::out_of_range("Absolute address is out of range for the current group type");
 
-    // Build address map
-    HexAddressMap map{getAddressMap()};
-
     // Define result
+    updateAddressRanges();
     HexDataSizeType result{0};
     while (result < dataSize)
     {
         // Current address
         const auto current{address + result};
 
-        // Find range in the address map
-        auto it{map.cbegin()};
-        for (; it != map.cend(); ++it)
-        {
-            // Range contains the current address or is range before the first range?
-            if ((current >= it->first) && (current < (it->first + it->second)))
-                break;
-            else if (current < it->first)
-                break;
-        }
+        // Find range containing the current address or the first range after it
+        const auto it{findAddressRange(addressRanges, current)};
 
-        if (it == map.cend())
+        if (it == addressRanges.cend())
         {
             // There is no data to clear, increment result
             result += (dataSize - result);
         }
-        else if (current < it->first)
+        else if (current < it->address)
         {
             // Current address is before the first range, so
             // calculate the difference from the current address
             // to the start of the range
-            const HexDataSizeType difference{it->first - current};
+            const HexDataSizeType difference{it->address - current};
 
             // Calculate the size with which result needs to be incremented
             const HexDataSizeType size{std::min(dataSize - result, difference)};
@@ -819,11 +899,11 @@ HexDataSizeType HexGroup::clearData(HexAddressType address, HexDataSizeType data
         }
         else
         {
-            // Find section from the range
-            HexSection& sect{getSection(findSection(current))};
+            // Section of the range
+            HexSection& sect{sections.at(it->index)};
 
             // Calculate the size of the data to get from the section
-            const HexDataSizeType size{std::min(dataSize - result, ((it->first + it->second) - current))};
+            const HexDataSizeType size{std::min(dataSize - result, ((it->address + it->size) - current))};
 
             // Clear data and increment the result
             result += sect.clearData(sect.getRelativeAddress(current), size);
@@ -840,10 +920,12 @@ HexDataType HexGroup::getData(HexAddressType address) const
     if (!HexAddress::isValidAbsoluteAddress(getGroupType(), address))
         throw std::out_of_range("Absolute address is out of range for the current group type");
 
-    // Iterate through all the sections to find the data
-    for (const auto& sect : sections)
+    // Find the section with the data
+    const auto index{findSection(address)};
+    if (index != std::string::npos)
     {
-        if (sect.hasData() && sect.hasAbsoluteAddress(address))
+        const auto& sect{sections.at(index)};
+        if (sect.hasData())
             return sect.getData(sect.getRelativeAddress(address));
     }
 
@@ -857,29 +939,19 @@ HexDataSizeType HexGroup::getData(HexAddressType address, HexDataType* data, Hex
     if (!HexAddress::isValidAbsoluteAddressRange(getGroupType(), address, dataSize))
         throw std::out_of_range("Absolute address is out of range for the current group type");
 
-    // Build address map
-    HexAddressMap map{getAddressMap()};
-
     // Define result and processed counts
+    HexAddressRangeVector rebuiltRanges{sections.get_allocator()};
+    const auto& ranges{getAddressRanges(rebuiltRanges)};
     HexDataSizeType result{0}, processed{0};
     while (processed < dataSize)
     {
         // Current address
         const auto current{address + processed};
 
-        // Find range in the address map
-        auto it{map.cbegin()};
-        for (; it != map.cend(); ++it)
-        {
-            // Range contains the current address or range is
-            // after the current range?
-            if ((current >= it->first) && (current < (it->first + it->second)))
-                break;
-            else if (current < it->first)
-                break;
-        }
+        // Find range containing the current address or the first range after it
+        const auto it{findAddressRange(ranges, current)};
 
-        if (it == map.cend())
+        if (it == ranges.cend())
         {
             // No ranges at or after the current address, use unused data fill value
             for (HexDataSizeType index{processed}; index < dataSize; ++index)
@@ -888,10 +960,10 @@ HexDataSizeType HexGroup::getData(HexAddressType address, HexDataType* data, Hex
             // Increment processed count, but not the result
             processed += (dataSize - processed);
         }
-        else if (it->first > current)
+        else if (it->address > current)
         {
             // Calculate difference from the current address to the start of the range
-            const HexDataSizeType difference{it->first - current};
+            const HexDataSizeType difference{it->address - current};
 
             // Calculate size for unused data fill value
             const HexDataSizeType size{std::min(dataSize - processed, difference)};
@@ -905,11 +977,11 @@ HexDataSizeType HexGroup::getData(HexAddressType address, HexDataType* data, Hex
         }
         else
         {
-            // Find section from the range
-            const HexSection& sect{getSection(findSection(it->first))};
+            // Section of the range
+            const HexSection& sect{sections.at(it->index)};
 
             // Calculate size of the data to get from the section
-            const HexDataSizeType size{std::min(dataSize - processed, ((it->first + it->second) - current))};
+            const HexDataSizeType size{std::min(dataSize - processed, ((it->address + it->size) - current))};
 
             // Get data, increment the result and processed count
             result += sect.getData(sect.getRelativeAddress(current), &data[processed], size);
@@ -931,29 +1003,19 @@ HexDataSizeType HexGroup::getData(HexAddressType address, HexDataVector& data, H
     if (!HexAddress::isValidAbsoluteAddressRange(getGroupType(), address, dataSize))
         throw std::out_of_range("Absolute address is out of range for the current group type");
 
-    // Build address map
-    HexAddressMap map{getAddressMap()};
-
     // Define result and processed counts
+    HexAddressRangeVector rebuiltRanges{sections.get_allocator()};
+    const auto& ranges{getAddressRanges(rebuiltRanges)};
     HexDataSizeType result{0}, processed{0};
     while (processed < dataSize)
     {
         // Current address
         const auto current{address + processed};
 
-        // Find range in the address map
-        auto it{map.cbegin()};
-        for (; it != map.cend(); ++it)
-        {
-            // Range contains the current address or range is
-            // after the current range?
-            if ((current >= it->first) && (current < (it->first + it->second)))
-                break;
-            else if (current < it->first)
-                break;
-        }
+        // Find range containing the current address or the first range after it
+        const auto it{findAddressRange(ranges, current)};
 
-        if (it == map.cend())
+        if (it == ranges.cend())
         {
             // No ranges at or after the current address, use unused data fill value
             for (HexDataSizeType index{processed}; index < dataSize; ++index)
@@ -967,10 +1029,10 @@ HexDataSizeType HexGroup::getData(HexAddressType address, HexDataVector& data, H
             // Increment processed count, but not the result
             processed += (dataSize - processed);
         }
-        else if (it->first > current)
+        else if (it->address > current)
         {
             // Calculate difference from the current address to the start of the range
-            const HexDataSizeType difference{it->first - current};
+            const HexDataSizeType difference{it->address - current};
 
             // Calculate size for unused data fill value
             const HexDataSizeType size{std::min(dataSize - processed, difference)};
@@ -989,11 +1051,11 @@ HexDataSizeType HexGroup::getData(HexAddressType address, HexDataVector& data, H
         }
         else
         {
-            // Find section from the range
-            const HexSection& sect{getSection(findSection(it->first))};
+            // Section of the range
+            const HexSection& sect{sections.at(it->index)};
 
             // Calculate size of the data to get from the section
-            const HexDataSizeType size{std::min(dataSize - processed, ((it->first + it->second) - current))};
+            const HexDataSizeType size{std::min(dataSize - processed, ((it->address + it->size) - current))};
 
             // Get data, increment the result and processed count
             result += sect.getData(sect.getRelativeAddress(current), data, size, processed + offset);
@@ -1020,12 +1082,10 @@ HexDataSizeType HexGroup::setData(HexAddressType address, HexDataType* data, Hex
     // Create section(s) for all the addresses
     createSection(address, dataSize);
 
-    // Build address map
-    HexAddressMap map{getAddressMap()};
-
-    // Define result and find range in the address map
+    // Define result and find range containing the address
+    updateAddressRanges();
     HexDataSizeType result{0};
-    for (auto it{map.cbegin()}; it != map.cend(); ++it)
+    for (auto it{findAddressRange(addressRanges, address)}; it != addressRanges.cend(); ++it)
     {
         // Are we done?
         if (result == dataSize)
@@ -1033,13 +1093,13 @@ HexDataSizeType HexGroup::setData(HexAddressType address, HexDataType* data, Hex
 
         // Range contains the current address?
         const auto current{address + result};
-        if (current < (it->first + it->second))
+        if (current < (it->address + it->size))
         {
-            // Find section from the range
-            HexSection& sect{getSection(findSection(current))};
+            // Section of the range
+            HexSection& sect{sections.at(it->index)};
 
             // Calculate size of the data to set in the section
-            const HexDataSizeType size{std::min(dataSize - result, ((it->first + it->second) - current))};
+            const HexDataSizeType size{std::min(dataSize - result, ((it->address + it->size) - current))};
 
             // Set data and increment the result
             result += sect.setData(sect.getRelativeAddress(current), &data[result], size);
@@ -1063,12 +1123,10 @@ HexDataSizeType HexGroup::setData(HexAddressType address, HexDataVector& data, H
     // Create section(s) for all the addresses
     createSection(address, dataSize);
 
-    // Build address map
-    HexAddressMap map{getAddressMap()};
-
-    // Define result and find range in the address map
+    // Define result and find range containing the address
+    updateAddressRanges();
     HexDataSizeType result{0};
-    for (auto it{map.cbegin()}; it != map.cend(); ++it)
+    for (auto it{findAddressRange(addressRanges, address)}; it != addressRanges.cend(); ++it)
     {
         // Are we done?
         if (result == dataSize)
@@ -1076,13 +1134,13 @@ HexDataSizeType HexGroup::setData(HexAddressType address, HexDataVector& data, H
 
         // Range contains the current address?
         const auto current{address + result};
-        if (current < (it->first + it->second))
+        if (current < (it->address + it->size))
         {
-            // Find section from the range
-            HexSection& sect{getSection(findSection(current))};
+            // Section of the range
+            HexSection& sect{sections.at(it->index)};
 
             // Calculate size of the data to set in the section
-            const HexDataSizeType size{std::min(dataSize - result, ((it->first + it->second) - current))};
+            const HexDataSizeType size{std::min(dataSize - result, ((it->address + it->size) - current))};
 
             // Set data and increment the result
             result += sect.setData(sect.getRelativeAddress(current), data, size, result + offset);
@@ -1098,12 +1156,10 @@ HexDataSizeType HexGroup::fillData(HexAddressType address, HexDataSizeType dataS
     // Create section(s) for all the addresses
     createSection(address, dataSize);
 
-    // Build address map
-    HexAddressMap map{getAddressMap()};
-
-    // Define result and find range in the address map
+    // Define result and find range containing the address
+    updateAddressRanges();
     HexDataSizeType result{0};
-    for (auto it{map.cbegin()}; it != map.cend(); ++it)
+    for (auto it{findAddressRange(addressRanges, address)}; it != addressRanges.cend(); ++it)
     {
         // Are we done?
         if (result == dataSize)
@@ -1111,13 +1167,13 @@ HexDataSizeType HexGroup::fillData(HexAddressType address, HexDataSizeType dataS
 
         // Range contains the current address?
         const auto current{address + result};
-        if (current < (it->first + it->second))
+        if (current < (it->address + it->size))
         {
-            // Find section from the range
-            HexSection& sect{getSection(findSection(current))};
+            // Section of the range
+            HexSection& sect{sections.at(it->index)};
 
             // Calculate size of the data to set in the section
-            const HexDataSizeType size{std::min(dataSize - result, ((it->first + it->second) - current))};
+            const HexDataSizeType size{std::min(dataSize - result, ((it->address + it->size) - current))};
 
             // Set data and increment the result
             result += sect.fillData(sect.getRelativeAddress(current), size, data);
@@ -1130,29 +1186,11 @@ HexDataSizeType HexGroup::fillData(HexAddressType address, HexDataSizeType dataS
 
 HexAddressEnumType HexGroup::getGroupType() const
 {
-    HexAddressEnumType result{HexAddressEnumType::ADDRESS_I8HEX};
-    for (const auto& section : sections)
-    {
-        switch (section.getSectionType())
-        {
-            case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
-            case HexSectionType::SECTION_START_SEGMENT_ADDRESS:
-                return HexAddressEnumType::ADDRESS_I16HEX;
-                break;
-
+    // Sections changed through the references may have changed the group type
+    if (!hasValidAddressRanges())
+        return findGroupType();
 
-            case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
-            case HexSectionType::SECTION_START_LINEAR_ADDRESS:
-                return HexAddressEnumType::ADDRESS_I32HEX;
-                break;
-
-            case HexSectionType::SECTION_DATA:
-            case HexSectionType::SECTION_END_OF_FILE:
-            default:
-                break;
-        }
-    }
-    return result;
+    return groupType;
 }
 
 bool HexGroup::hasDataSections() const
@@ -1190,6 +1228,21 @@ void HexGroup::setUnusedDataFillValue(HexDataType unusedDataFillValue)
         sect.setUnusedDataFillValue(unusedDataFillValue);
 }
 
+HexSectionStorageType HexGroup::getSectionStorageType() const
+{
+    return sectionStorageType;
+}
+
+void HexGroup::setSectionStorageType(HexSectionStorageType sectionStorageType)
+{
+    if ((sectionStorageType < HexSectionStorageType::STORAGE_MIN) || (sectionStorageType > HexSectionStorageType::STORAGE_MAX))
+        throw std::invalid_argument("Storage type is not valid");
+
+    this->sectionStorageType = sectionStorageType;
+    for (auto& sect : sections)
+        sect.setStorageType(sectionStorageType);
+}
+
 bool HexGroup::supportsStartSegmentAddress() const
 {
     for (const auto& sect : sections)
@@ -1227,10 +1280,12 @@ void HexGroup::clearStartSegmentAddress()
     for (auto it{sections.begin()}; it != sections.end();)
     {
         if (it->getSectionType() == HexSectionType::SECTION_START_SEGMENT_ADDRESS)
-            it = sections.erase(it);
+            it = eraseSection(it);
         else
             ++it;
     }
+
+    rebuildAddressRanges();
 }
 
 const HexSection& HexGroup::getStartSegmentAddressSection() const
@@ -1244,9 +1299,9 @@ const HexSection& HexGroup::getStartSegmentAddressSection() const
 
 HexSection& HexGroup::getStartSegmentAddressSection()
 {
-    for (auto& sect : sections)
-        if (sect.getSectionType() == HexSectionType::SECTION_START_SEGMENT_ADDRESS)
-            return sect;
+    for (size_t index{0}; index < sections.size(); ++index)
+        if (sections.at(index).getSectionType() == HexSectionType::SECTION_START_SEGMENT_ADDRESS)
+            return referenceSection(index);
 
     throw std::runtime_error("SECTION_START_SEGMENT_ADDRESS section not supported or found");
 }
@@ -1348,10 +1403,12 @@ void HexGroup::clearStartLinearAddress()
     for (auto it{sections.begin()}; it != sections.end();)
     {
         if (it->getSectionType() == HexSectionType::SECTION_START_LINEAR_ADDRESS)
-            it = sections.erase(it);
+            it = eraseSection(it);
         else
             ++it;
     }
+
+    rebuildAddressRanges();
 }
 
 const HexSection& HexGroup::getStartLinearAddressSection() const
@@ -1365,9 +1422,9 @@ const HexSection& HexGroup::getStartLinearAddressSection() const
 
 HexSection& HexGroup::getStartLinearAddressSection()
 {
-    for (auto& sect : sections)
-        if (sect.getSectionType() == HexSectionType::SECTION_START_LINEAR_ADDRESS)
-            return sect;
+    for (size_t index{0}; index < sections.size(); ++index)
+        if (sections.at(index).getSectionType() == HexSectionType::SECTION_START_LINEAR_ADDRESS)
+            return referenceSection(index);
 
     throw std::runtime_error("SECTION_START_LINEAR_ADDRESS section not supported or found");
 }
@@ -1426,4 +1483,188 @@ size_t HexGroup::getSectionDefaultPushIndex(const HexSection& section) const
     }
 }
 
+bool HexGroup::HexAddressRange::operator<(const HexAddressRange& range) const
+{
+    return (address < range.address);
+}
+
+HexSection& HexGroup::referenceSection(size_t index)
+{
+    auto& sect{sections.at(index)};
+
+    // Keep the state of the section from the last update of the address ranges once,
+    // so that the changes through the reference are detected
+    if (referencedSections.size() < sections.size())
+        referencedSections.resize(sections.size(), false);
+
+    if (!referencedSections.at(index))
+    {
+        referencedSections.at(index) = true;
+        sectionReferences.push_back(makeSectionReference(index));
+    }
+
+    return sect;
+}
+
+void HexGroup::dropSectionReferences(size_t index)
+{
+    if (referencedSections.size() <= index)
+        return;
+
+    referencedSections.resize(index);
+    sectionReferences.erase(std::remove_if(sectionReferences.begin(), sectionReferences.end(),
+        [index](const HexSectionReference& reference) { return (reference.index >= index); }), sectionReferences.end());
+}
+
+HexSectionVector::iterator HexGroup::eraseSection(HexSectionVector::const_iterator it)
+{
+    // Erasing the section invalidates the references at and after it
+    dropSectionReferences(static_cast<size_t>(std::distance(sections.cbegin(), it)));
+    return sections.erase(it);
+}
+
+HexGroup::HexSectionReference HexGroup::makeSectionReference(size_t index) const
+{
+    const auto& sect{sections.at(index)};
+    switch (sect.getSectionType())
+    {
+        case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
+            return HexSectionReference{index, sect.getSectionType(), sect.getExtendedSegmentAddress()};
+            break;
+
+        case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
+            return HexSectionReference{index, sect.getSectionType(), sect.getExtendedLinearAddress()};
+            break;
+
+        case HexSectionType::SECTION_DATA:
+        case HexSectionType::SECTION_END_OF_FILE:
+        case HexSectionType::SECTION_START_SEGMENT_ADDRESS:
+        case HexSectionType::SECTION_START_LINEAR_ADDRESS:
+        default:
+            return HexSectionReference{index, sect.getSectionType(), 0};
+            break;
+    }
+}
+
+bool HexGroup::hasValidAddressRanges() const
+{
+    // Only the sections changed through the references can be out of date
+    for (const auto& reference : sectionReferences)
+    {
+        if (reference.index >= sections.size())
+            return false;
+
+        const auto current{makeSectionReference(reference.index)};
+        if ((current.type != reference.type) || (current.extendedAddress != reference.extendedAddress))
+            return false;
+    }
+
+    return true;
+}
+
+void HexGroup::updateAddressRanges()
+{
+    if (!hasValidAddressRanges())
+        rebuildAddressRanges();
+}
+
+void HexGroup::rebuildAddressRanges()
+{
+    // Collect the ranges of all the sections with addresses
+    addressRanges.clear();
+    for (size_t index{0}; index < sections.size(); ++index)
+        appendAddressRanges(addressRanges, index);
+
+    std::sort(addressRanges.begin(), addressRanges.end());
+    groupType = findGroupType();
+    addressCursor.store(0, std::memory_order_relaxed);
+
+    // Current state of the referenced sections
+    dropSectionReferences(sections.size());
+    for (auto& reference : sectionReferences)
+        reference = makeSectionReference(reference.index);
+}
+
+void HexGroup::appendAddressRanges(HexAddressRangeVector& ranges, size_t index) const
+{
+    const auto& sect{sections.at(index)};
+    if (!sect.hasAddress())
+        return;
+
+    // Section address map is ordered, so the appended ranges are sorted
+    for (const auto& range : sect.getAddressMap())
+        ranges.push_back(HexAddressRange{range.first, range.second, index});
+}
+
+const HexGroup::HexAddressRangeVector& HexGroup::getAddressRanges(HexAddressRangeVector& ranges) const
+{
+    if (hasValidAddressRanges())
+        return addressRanges;
+
+    // Collect the current ranges without modifying the group
+    for (size_t index{0}; index < sections.size(); ++index)
+        appendAddressRanges(ranges, index);
+
+    std::sort(ranges.begin(), ranges.end());
+    return ranges;
+}
+
+HexGroup::HexAddressRangeVector::const_iterator HexGroup::findAddressRange(const HexAddressRangeVector& ranges, HexAddressType address) const
+{
+    // Check the range of the last lookup and the one following it first
+    const bool cached{&ranges == &addressRanges};
+    const auto lastCursor{cached ? addressCursor.load(std::memory_order_relaxed) : ranges.size()};
+    for (auto cursor{lastCursor}; (cursor < ranges.size()) && (cursor <= (lastCursor + 1)); ++cursor)
+    {
+        const auto& range{ranges.at(cursor)};
+        if ((range.address <= address) && ((address - range.address) < range.size))
+        {
+            addressCursor.store(cursor, std::memory_order_relaxed);
+            return std::next(ranges.cbegin(), static_cast<std::ptrdiff_t>(cursor));
+        }
+    }
+
+    // Range before the first range starting after the address
+    auto it{std::upper_bound(ranges.cbegin(), ranges.cend(), HexAddressRange{address, 0, 0})};
+    if (it != ranges.cbegin())
+    {
+        const auto prev{std::prev(it)};
+        if ((address - prev->address) < prev->size)
+            it = prev;
+    }
+
+    // Remember the range containing the address
+    if (cached && (it != ranges.cend()) && (it->address <= address))
+        addressCursor.store(static_cast<size_t>(std::distance(ranges.cbegin(), it)), std::memory_order_relaxed);
+
+    return it;
+}
+
+HexAddressEnumType HexGroup::findGroupType() const
+{
+    HexAddressEnumType result{HexAddressEnumType::ADDRESS_I8HEX};
+    for (const auto& section : sections)
+    {
+        switch (section.getSectionType())
+        {
+            case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
+            case HexSectionType::SECTION_START_SEGMENT_ADDRESS:
+                return HexAddressEnumType::ADDRESS_I16HEX;
+                break;
+
+
+            case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
+            case HexSectionType::SECTION_START_LINEAR_ADDRESS:
+                return HexAddressEnumType::ADDRESS_I32HEX;
+                break;
+
+            case HexSectionType::SECTION_DATA:
+            case HexSectionType::SECTION_END_OF_FILE:
+            default:
+                break;
+        }
+    }
+    return result;
+}
+
 END_NAMESPACE_LIBIHEX
@@ -0,0 +1,191 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <utility>
+#include <ihex/hex_image.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+HexImage::HexImage(HexDataType fillValue) :
+    HexVisitor{}, baseAddress{0}, vector{}, frontSize{0}, buffer{nullptr}, bufferSize{0}, fillValue{fillValue}, writtenMap{}, discardedSize{0}
+{
+
+}
+
+HexImage::HexImage(HexAddressType baseAddress, HexDataType* data, HexDataSizeType dataSize, HexDataType fillValue) :
+    HexVisitor{}, baseAddress{baseAddress}, vector{}, frontSize{0}, buffer{data}, bufferSize{dataSize}, fillValue{fillValue}, writtenMap{}, discardedSize{0}
+{
+    std::fill(buffer, buffer + bufferSize, fillValue);
+}
+
+HexAddressType HexImage::getBaseAddress() const
+{
+    return baseAddress;
+}
+
+const HexDataType* HexImage::getData() const
+{
+    return (isExternal() ? buffer : (vector.data() + frontSize));
+}
+
+HexDataSizeType HexImage::getSize() const
+{
+    return (isExternal() ? bufferSize : (vector.size() - frontSize));
+}
+
+HexDataVector HexImage::releaseDataVector()
+{
+    if (isExternal())
+        return HexDataVector{};
+
+    // Drop the headroom in front of the image
+    vector.erase(vector.begin(), vector.begin() + static_cast<std::ptrdiff_t>(frontSize));
+    frontSize = 0;
+
+    HexDataVector result{std::move(vector)};
+    clear();
+    return result;
+}
+
+HexDataType HexImage::getFillValue() const
+{
+    return fillValue;
+}
+
+const HexAddressMap& HexImage::getWrittenMap() const
+{
+    return writtenMap;
+}
+
+HexDataSizeType HexImage::getDiscardedSize() const
+{
+    return discardedSize;
+}
+
+bool HexImage::isExternal() const
+{
+    return (buffer != nullptr);
+}
+
+void HexImage::clear()
+{
+    reset();
+    writtenMap.clear();
+    discardedSize = 0;
+
+    if (isExternal())
+        std::fill(buffer, buffer + bufferSize, fillValue);
+    else
+    {
+        vector.clear();
+        frontSize = 0;
+        baseAddress = 0;
+    }
+}
+
+void HexImage::onData(HexAddressType address, const HexDataType* data, HexDataSizeType dataSize)
+{
+    if (isExternal())
+    {
+        // Clip the run to the caller buffer
+        const auto begin{std::max(static_cast<HexDataSizeType>(address), static_cast<HexDataSizeType>(baseAddress))};
+        const auto end{std::min(static_cast<HexDataSizeType>(address) + dataSize, static_cast<HexDataSizeType>(baseAddress) + bufferSize)};
+        if (begin >= end)
+        {
+            discardedSize += dataSize;
+            return;
+        }
+
+        std::memcpy(buffer + (begin - baseAddress), data + (begin - address), end - begin);
+        discardedSize += (dataSize - (end - begin));
+        pushWrittenRange(static_cast<HexAddressType>(begin), end - begin);
+        return;
+    }
+
+    if (vector.size() == 0)
+    {
+        // First run sets the base address
+        baseAddress = address;
+        vector.assign(data, data + dataSize);
+        frontSize = 0;
+        pushWrittenRange(address, dataSize);
+        return;
+    }
+
+    // Grow the image in front of the base address
+    if (address < baseAddress)
+    {
+        // Add headroom of at least the size of the image, so that the data
+        // is moved only a logarithmic number of times
+        const auto growth{static_cast<HexDataSizeType>(baseAddress - address)};
+        if (growth > frontSize)
+        {
+            const auto headroom{std::max(growth - frontSize, getSize())};
+            vector.insert(vector.begin(), headroom, fillValue);
+            frontSize += headroom;
+        }
+
+        frontSize -= growth;
+        baseAddress = address;
+    }
+
+    // Grow the vector past the end
+    const auto end{frontSize + static_cast<HexDataSizeType>(address - baseAddress) + dataSize};
+    if (end > vector.size())
+        vector.resize(end, fillValue);
+
+    std::memcpy(vector.data() + frontSize + (address - baseAddress), data, dataSize);
+    pushWrittenRange(address, dataSize);
+}
+
+void HexImage::pushWrittenRange(HexAddressType address, HexDataSizeType size)
+{
+    auto begin{static_cast<HexDataSizeType>(address)};
+    auto end{begin + size};
+
+    // Merge with the previous range if it overlaps or is adjacent
+    auto it{writtenMap.upper_bound(address)};
+    if (it != writtenMap.begin())
+    {
+        auto previous{std::prev(it)};
+        if ((static_cast<HexDataSizeType>(previous->first) + previous->second) >= begin)
+        {
+            begin = previous->first;
+            end = std::max(end, static_cast<HexDataSizeType>(previous->first) + previous->second);
+            it = writtenMap.erase(previous);
+        }
+    }
+
+    // Merge with the following ranges if they overlap or are adjacent
+    while ((it != writtenMap.end()) && (static_cast<HexDataSizeType>(it->first) <= end))
+    {
+        end = std::max(end, static_cast<HexDataSizeType>(it->first) + it->second);
+        it = writtenMap.erase(it);
+    }
+
+    writtenMap.emplace_hint(it, static_cast<HexAddressType>(begin), end - begin);
+}
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,282 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <ihex/hex_page.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+namespace
+{
+    /**
+     * @brief Number of the addresses per bitmap word
+     *
+     */
+    static constexpr HexDataSizeType BITMAP_WORD_SIZE{64};
+
+    /**
+     * @brief Count the trailing zero bits
+     *
+     * @param value Value (not zero)
+     * @return HexDataSizeType Number of the trailing zero bits
+     */
+    HexDataSizeType countTrailingZeros(uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<HexDataSizeType>(__builtin_ctzll(value));
+#else
+        HexDataSizeType result{0};
+        for (; (value & 1) == 0; value >>= 1)
+            result++;
+
+        return result;
+#endif
+    }
+
+    /**
+     * @brief Count the leading zero bits
+     *
+     * @param value Value (not zero)
+     * @return HexDataSizeType Number of the leading zero bits
+     */
+    HexDataSizeType countLeadingZeros(uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<HexDataSizeType>(__builtin_clzll(value));
+#else
+        HexDataSizeType result{0};
+        for (; (value & (uint64_t{1} << (BITMAP_WORD_SIZE - 1))) == 0; value <<= 1)
+            result++;
+
+        return result;
+#endif
+    }
+
+    /**
+     * @brief Count the set bits
+     *
+     * @param value Value
+     * @return HexDataSizeType Number of the set bits
+     */
+    HexDataSizeType countBits(uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<HexDataSizeType>(__builtin_popcountll(value));
+#else
+        HexDataSizeType result{0};
+        for (; value != 0; value &= (value - 1))
+            result++;
+
+        return result;
+#endif
+    }
+
+    /**
+     * @brief Find the first set bit of a bitmap
+     *
+     * @param bitmap Bitmap
+     * @param address Address to search from
+     * @param inverted Search for the first clear bit instead
+     * @return HexDataSizeType Address of the bit (HEX_PAGE_SIZE if there is none)
+     */
+    HexDataSizeType findBit(const std::pmr::vector<uint64_t>& bitmap, HexDataSizeType address, bool inverted)
+    {
+        if (address >= HEX_PAGE_SIZE)
+            return HEX_PAGE_SIZE;
+
+        // Skip the words without the searched bits
+        auto word{address / BITMAP_WORD_SIZE};
+        auto value{(inverted ? ~bitmap[word] : bitmap[word]) & (~uint64_t{0} << (address % BITMAP_WORD_SIZE))};
+        while (value == 0)
+        {
+            if (++word == bitmap.size())
+                return HEX_PAGE_SIZE;
+
+            value = (inverted ? ~bitmap[word] : bitmap[word]);
+        }
+
+        return ((word * BITMAP_WORD_SIZE) + countTrailingZeros(value));
+    }
+}
+
+HexPage::HexPage() :
+    data{}, bitmap{}, dataSize{0}
+{
+
+}
+
+HexPage::HexPage(const allocator_type& allocator) :
+    data{allocator}, bitmap{allocator}, dataSize{0}
+{
+
+}
+
+HexPage::HexPage(const HexPage& page, const allocator_type& allocator) :
+    data{page.data, allocator}, bitmap{page.bitmap, allocator}, dataSize{page.dataSize}
+{
+
+}
+
+HexPage::HexPage(HexPage&& page, const allocator_type& allocator) :
+    data{std::move(page.data), allocator}, bitmap{std::move(page.bitmap), allocator}, dataSize{page.dataSize}
+{
+    page.clearData();
+}
+
+HexPage::allocator_type HexPage::get_allocator() const
+{
+    return data.get_allocator();
+}
+
+bool HexPage::hasData() const
+{
+    return (dataSize > 0);
+}
+
+bool HexPage::hasData(HexDataAddressType address) const
+{
+    return (!bitmap.empty() && ((bitmap[address / BITMAP_WORD_SIZE] >> (address % BITMAP_WORD_SIZE)) & 1));
+}
+
+HexDataSizeType HexPage::getDataSize() const
+{
+    return dataSize;
+}
+
+const HexDataType* HexPage::getData() const
+{
+    return (data.empty() ? nullptr : data.data());
+}
+
+HexDataType* HexPage::getData()
+{
+    return (data.empty() ? nullptr : data.data());
+}
+
+void HexPage::getData(HexDataAddressType address, HexDataType* data, HexDataSizeType dataSize, HexDataType unusedDataFillValue) const
+{
+    // Copy the runs of data and fill the gaps between them
+    const HexDataSizeType end{static_cast<HexDataSizeType>(address) + dataSize};
+    HexDataSizeType current{address};
+    while (current < end)
+    {
+        const auto first{this->data.empty() ? end : std::min(findData(current), end)};
+        std::memset(data + (current - address), unusedDataFillValue, first - current);
+        if (first == end)
+            break;
+
+        const auto last{std::min(findGap(first), end)};
+        std::memcpy(data + (first - address), this->data.data() + first, last - first);
+        current = last;
+    }
+}
+
+void HexPage::setData(HexDataAddressType address, const HexDataType* data, HexDataSizeType dataSize)
+{
+    allocate();
+    std::memcpy(this->data.data() + address, data, dataSize);
+    markData(address, dataSize, true);
+}
+
+void HexPage::fillData(HexDataAddressType address, HexDataSizeType dataSize, HexDataType data)
+{
+    allocate();
+    std::memset(this->data.data() + address, data, dataSize);
+    markData(address, dataSize, true);
+}
+
+void HexPage::clearData()
+{
+    // Swap with empty buffers of the same allocator to release the memory
+    std::pmr::vector<HexDataType>{data.get_allocator()}.swap(data);
+    std::pmr::vector<uint64_t>{bitmap.get_allocator()}.swap(bitmap);
+    dataSize = 0;
+}
+
+void HexPage::clearData(HexDataAddressType address, HexDataSizeType dataSize)
+{
+    if (!bitmap.empty())
+        markData(address, dataSize, false);
+}
+
+HexDataSizeType HexPage::findData(HexDataSizeType address) const
+{
+    return (bitmap.empty() ? HEX_PAGE_SIZE : findBit(bitmap, address, false));
+}
+
+HexDataSizeType HexPage::findGap(HexDataSizeType address) const
+{
+    if (bitmap.empty())
+        return std::min(address, HEX_PAGE_SIZE);
+
+    return findBit(bitmap, address, true);
+}
+
+HexDataSizeType HexPage::findLastData() const
+{
+    // Search the words from the end of the page
+    for (auto word{bitmap.size()}; word > 0; --word)
+    {
+        if (bitmap[word - 1] != 0)
+            return ((word * BITMAP_WORD_SIZE) - 1 - countLeadingZeros(bitmap[word - 1]));
+    }
+
+    return HEX_PAGE_SIZE;
+}
+
+void HexPage::allocate()
+{
+    if (data.empty())
+    {
+        data.resize(HEX_PAGE_SIZE);
+        bitmap.resize(HEX_PAGE_SIZE / BITMAP_WORD_SIZE);
+    }
+}
+
+void HexPage::markData(HexDataSizeType address, HexDataSizeType dataSize, bool used)
+{
+    // Update the bits word by word
+    const auto end{address + dataSize};
+    while (address < end)
+    {
+        const auto bit{address % BITMAP_WORD_SIZE};
+        const auto count{std::min(end - address, BITMAP_WORD_SIZE - bit)};
+        const auto mask{(count == BITMAP_WORD_SIZE) ? ~uint64_t{0} : (((uint64_t{1} << count) - 1) << bit)};
+
+        auto& value{bitmap[address / BITMAP_WORD_SIZE]};
+        if (used)
+        {
+            this->dataSize += countBits(mask & ~value);
+            value |= mask;
+        }
+        else
+        {
+            this->dataSize -= countBits(mask & value);
+            value &= ~mask;
+        }
+
+        address += count;
+    }
+}
+
+END_NAMESPACE_LIBIHEX
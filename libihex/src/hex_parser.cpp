@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <ihex/hex_parser.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+namespace
+{
+    /**
+     * @brief Maximum size of the carried over line
+     *
+     * @note Record parsing ignores the characters past the checksum,
+     *   so longer lines are truncated to bound the memory use
+     */
+    constexpr size_t MAXIMUM_PENDING_LINE_SIZE{4 * (MAXIMUM_HEX_RECORD_DATA_SIZE + 6)};
+}
+
+HexParser::HexParser(HexFile& file) :
+    file{file}, pending{}, pendingLineSize{0}
+{
+    file.resetLinePosition();
+}
+
+bool HexParser::feed(const char* data, size_t dataSize)
+{
+    bool result{true};
+    auto end{data + dataSize};
+    while (data < end)
+    {
+        auto separator{static_cast<const char*>(std::memchr(data, HEX_RECORD_LINE_SEPARATOR, end - data))};
+        if (separator == nullptr)
+        {
+            // Carry the incomplete line over to the next chunk
+            auto size{std::min(static_cast<size_t>(end - data), MAXIMUM_PENDING_LINE_SIZE - std::min(pending.size(), MAXIMUM_PENDING_LINE_SIZE))};
+            pending.append(data, size);
+            pendingLineSize += (end - data);
+            break;
+        }
+
+        if (pendingLineSize == 0)
+        {
+            // Load the complete line in place
+            if (!file.loadLine(std::string_view{data, static_cast<size_t>(separator - data)}))
+                result = false;
+        }
+        else
+        {
+            // Complete the carried over line
+            auto size{std::min(static_cast<size_t>(separator - data), MAXIMUM_PENDING_LINE_SIZE - std::min(pending.size(), MAXIMUM_PENDING_LINE_SIZE))};
+            pending.append(data, size);
+
+            std::string line;
+            line.swap(pending);
+            auto lineSize{pendingLineSize + (separator - data) + 1};
+            pendingLineSize = 0;
+            if (!file.loadLine(line, lineSize))
+                result = false;
+        }
+
+        data = separator + 1;
+    }
+
+    return result;
+}
+
+bool HexParser::finish()
+{
+    // Nothing to load
+    if (pendingLineSize == 0)
+        return true;
+
+    std::string line;
+    line.swap(pending);
+    auto lineSize{pendingLineSize};
+    pendingLineSize = 0;
+    return file.loadLine(line, lineSize);
+}
+
+void HexParser::reset()
+{
+    pending.clear();
+    pendingLineSize = 0;
+    file.resetLinePosition();
+}
+
+size_t HexParser::getPendingSize() const
+{
+    return pending.size();
+}
+
+END_NAMESPACE_LIBIHEX
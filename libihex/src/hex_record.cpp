@@ -20,25 +20,23 @@
 */
 
 #include <algorithm>
-#include <sstream>
 #include <stdexcept>
-#include <iomanip>
+#include <ihex/hex_codec.hpp>
 #include <ihex/hex_record.hpp>
 
 BEGIN_NAMESPACE_LIBIHEX
 
 HexRecord::HexRecord() :
-    address{0}, recordType{HexRecordType::RECORD_DATA}, data{}, checksum{0}
+    address{0}, recordType{HexRecordType::RECORD_DATA}, data{}, dataSize{0}, checksum{0}
 {
-    // Reserve space for default data record and add single byte of data
-    // for the record to be valid
-    data.reserve(DEFAULT_HEX_RECORD_DATA_SIZE);
-    data.push_back(DEFAULT_HEX_RECORD_DATA_VALUE);
+    // Add single byte of data for the record to be valid
+    data[0] = DEFAULT_HEX_RECORD_DATA_VALUE;
+    dataSize = 1;
     updateChecksum();
 }
 
 HexRecord::HexRecord(const std::string& record) :
-    address{0}, recordType{HexRecordType::RECORD_DATA}, data{}, checksum{0}
+    address{0}, recordType{HexRecordType::RECORD_DATA}, data{}, dataSize{0}, checksum{0}
 {
     if (!setRecord(record))
         throw std::runtime_error("Failed to parse record in string format");
@@ -48,7 +46,7 @@ HexRecord::HexRecord(const std::string& record) :
 }
 
 HexRecord::HexRecord(HexRecordType recordType) :
-    address{0}, recordType{recordType}, data{}, checksum{0}
+    address{0}, recordType{recordType}, data{}, dataSize{0}, checksum{0}
 {
     switch (recordType)
     {
@@ -84,12 +82,18 @@ HexRecord::HexRecord(HexRecordType recordType) :
 
 HexDataType HexRecord::operator[](HexDataSizeType index) const
 {
-    return data.at(index);
+    if (index >= dataSize)
+        throw std::out_of_range("Index is out of range");
+
+    return data[index];
 }
 
 HexDataType& HexRecord::operator[](HexDataSizeType index)
 {
-    return data.at(index);
+    if (index >= dataSize)
+        throw std::out_of_range("Index is out of range");
+
+    return data[index];
 }
 
 HexRecord HexRecord::makeDataRecord(HexDataAddressType address, const HexDataVector& data)
@@ -156,8 +160,7 @@ void HexRecord::prepareRecord(HexDataAddressType address, HexRecordType recordTy
     this->address = address;
     this->recordType = recordType;
 
-    for (HexDataSizeType index{0}; index < this->data.size(); ++index)
-            this->data.at(index) = data.at(index);
+    std::copy(data.cbegin(), data.cend(), this->data.begin());
 
     this->checksum = ((checksum == 0) ? calculateChecksum() : checksum);
 }
@@ -170,8 +173,7 @@ void HexRecord::prepareRecord(HexDataAddressType address, HexRecordType recordTy
     this->address = address;
     this->recordType = recordType;
 
-    for (HexDataSizeType index{0}; index < this->data.size(); ++index)
-        this->data.at(index) = data[index];
+    std::copy(data, data + dataSize, this->data.begin());
 
     this->checksum = ((checksum == 0) ? calculateChecksum() : checksum);
 }
@@ -196,8 +198,7 @@ void HexRecord::prepareEndOfFileRecord()
 {
     address = 0;
     recordType = HexRecordType::RECORD_END_OF_FILE;
-    data.clear();
-    data.shrink_to_fit();
+    dataSize = 0;
     checksum = calculateChecksum();
 }
 
@@ -205,8 +206,7 @@ void HexRecord::prepareExtendedSegmentAddressRecord(uint16_t segmentAddress)
 {
     address = 0;
     recordType = HexRecordType::RECORD_EXTENDED_SEGMENT_ADDRESS;
-    data.resize(2);
-    data.shrink_to_fit();
+    dataSize = 2;
     setExtendedSegmentAddress(segmentAddress);
 }
 
@@ -214,8 +214,7 @@ void HexRecord::prepareStartSegmentAddressRecord(uint16_t codeSegment, uint16_t
 {
     address = 0;
     recordType = HexRecordType::RECORD_START_SEGMENT_ADDRESS;
-    data.resize(4);
-    data.shrink_to_fit();
+    dataSize = 4;
     setStartSegmentAddressCodeSegment(codeSegment);
     setStartSegmentAddressInstructionPointer(instructionPointer);
 }
@@ -224,8 +223,7 @@ void HexRecord::prepareExtendedLinearAddressRecord(uint16_t linearAddress)
 {
     address = 0;
     recordType = HexRecordType::RECORD_EXTENDED_LINEAR_ADDRESS;
-    data.resize(2);
-    data.shrink_to_fit();
+    dataSize = 2;
     setExtendedLinearAddress(linearAddress);
 }
 
@@ -233,8 +231,7 @@ void HexRecord::prepareStartLinearAddressRecord(uint32_t extendedInstructionPoin
 {
     address = 0;
     recordType = HexRecordType::RECORD_START_LINEAR_ADDRESS;
-    data.resize(4);
-    data.shrink_to_fit();
+    dataSize = 4;
     setStartLinearAddressExtendedInstructionPointer(extendedInstructionPointer);
 }
 
@@ -246,7 +243,7 @@ void HexRecord::updateChecksum()
 HexDataType HexRecord::calculateChecksum() const
 {
     // Size of the record
-    auto checksum{static_cast<HexDataType>(data.size())};
+    auto checksum{static_cast<HexDataType>(dataSize)};
 
     // Address of the record
     checksum += ((address >> 8) & 0xFF);
@@ -256,8 +253,8 @@ HexDataType HexRecord::calculateChecksum() const
     checksum += static_cast<HexDataType>(recordType);
 
     // Data of the record
-    for (const auto& dataItem : data)
-        checksum += dataItem;
+    for (HexDataSizeType index{0}; index < dataSize; ++index)
+        checksum += data[index];
 
     // Checksum of the record, return 2's complement
     return -static_cast<int>(checksum);
@@ -270,76 +267,82 @@ bool HexRecord::isValidChecksum() const
 
 std::string HexRecord::getRecord() const
 {
-    std::ostringstream stream;
-
-    // Start of the record character
-    stream << START_OF_HEX_RECORD_CHARACTER;
-
-    // Prepare stream
-    stream << std::setfill('0') << std::uppercase << std::hex;
-
-    // Size of the record
-    stream << std::setw(2) << static_cast<unsigned int>(data.size());
+    std::string result;
+    encode(result);
+    return result;
+}
 
-    // Address of the record
-    stream << std::setw(4) << static_cast<unsigned int>(address);
+HexDataSizeType HexRecord::getRecordLength() const
+{
+    return (11 + (2 * dataSize));
+}
 
-    // Type of the record
-    stream << std::setw(2) << static_cast<unsigned int>(recordType);
+HexDataSizeType HexRecord::encode(char* record) const
+{
+    return getView().encode(record);
+}
 
-    // Data of the record
-    for (const auto& dataItem : data)
-        stream << std::setw(2) << static_cast<unsigned int>(dataItem);
+HexDataSizeType HexRecord::encode(std::string& record) const
+{
+    return getView().encode(record);
+}
 
-    // Checksum of the record
-    stream << std::setw(2) << static_cast<unsigned int>(checksum);
+HexRecordView HexRecord::getView() const
+{
+    return HexRecordView{address, recordType, data.data(), dataSize, checksum};
+}
 
-    // Return record as a string
-    return stream.str();
+bool HexRecord::setRecord(std::string_view record)
+{
+    return setRecord(record.data(), record.size());
 }
 
-bool HexRecord::setRecord(const std::string& record)
+bool HexRecord::setRecord(const char* record, HexDataSizeType recordSize)
 {
     HexDataSizeType position{1};
-    if (record.size() < (position + 3))
+    if (recordSize < (position + 3))
         return false;
 
     // Parse size of data
-    HexDataSizeType dataSize{static_cast<HexDataSizeType>(strtol(record.substr(position, 2).c_str(), nullptr, 16))};
+    HexDataType dataSize{0};
+    if (!HexCodec::decodeByte(record + position, dataSize))
+        return false;
     position += 2;
 
-    // Check length
-    if (record.size() < (10U + (2 * dataSize)))
+    // Check length (start character, size, address, type, data and checksum)
+    if (recordSize < (11U + (2 * static_cast<HexDataSizeType>(dataSize))))
         return false;
 
     // Set size of data
     setDataSize(dataSize);
 
     // Parse address
-    address = static_cast<HexDataAddressType>(strtol(record.substr(position, 4).c_str(), nullptr, 16));
+    if (!HexCodec::decodeWord(record + position, address))
+        return false;
     position += 4;
 
     // Parse record type
-    recordType = static_cast<HexRecordType>(strtol(record.substr(position, 2).c_str(), nullptr, 16));
-    recordType = std::min(recordType, HexRecordType::RECORD_MAX);
+    HexDataType type{0};
+    if (!HexCodec::decodeByte(record + position, type))
+        return false;
+    recordType = std::min(static_cast<HexRecordType>(type), HexRecordType::RECORD_MAX);
     position += 2;
 
     // Parse record data
-    for (auto& dataByte : data)
-    {
-        dataByte = static_cast<HexDataType>(strtol(record.substr(position, 2).c_str(), nullptr, 16));
-        position += 2;
-    }
+    if (!HexCodec::decode(record + position, data.data(), this->dataSize))
+        return false;
+    position += (2 * this->dataSize);
 
     // Parse checksum
-    checksum = static_cast<HexDataType>(strtol(record.substr(position, 2).c_str(), nullptr, 16));
+    if (!HexCodec::decodeByte(record + position, checksum))
+        return false;
 
     return isValidRecord();
 }
 
 HexDataSizeType HexRecord::getDataSize() const
 {
-    return data.size();
+    return dataSize;
 }
 
 bool HexRecord::setDataSize(HexDataSizeType dataSize)
@@ -347,8 +350,11 @@ bool HexRecord::setDataSize(HexDataSizeType dataSize)
     if (dataSize > MAXIMUM_HEX_RECORD_DATA_SIZE)
         return false;
 
-    data.reserve(std::max(dataSize, DEFAULT_HEX_RECORD_DATA_SIZE));
-    data.resize(dataSize, DEFAULT_HEX_RECORD_DATA_VALUE);
+    // Added data is set to the default value
+    if (dataSize > this->dataSize)
+        std::fill(data.begin() + this->dataSize, data.begin() + dataSize, DEFAULT_HEX_RECORD_DATA_VALUE);
+
+    this->dataSize = dataSize;
 
     updateChecksum();
     return true;
@@ -368,14 +374,14 @@ void HexRecord::setAddress(HexDataAddressType address)
 HexDataAddressType HexRecord::getLastAddress() const
 {
     if (hasAddress())
-        return (address + static_cast<HexDataAddressType>(data.size()) - 1);
+        return (address + static_cast<HexDataAddressType>(dataSize) - 1);
     else
         throw std::domain_error("Record does not support or does not have addresses");
 }
 
 bool HexRecord::hasAddress() const
 {
-    return ((recordType == HexRecordType::RECORD_DATA) && (data.size() > 0));
+    return ((recordType == HexRecordType::RECORD_DATA) && (dataSize > 0));
 }
 
 bool HexRecord::hasAddress(HexDataAddressType address) const
@@ -401,10 +407,15 @@ bool HexRecord::setRecordType(HexRecordType recordType)
     return true;
 }
 
+const HexDataType* HexRecord::getData() const
+{
+    return data.data();
+}
+
 HexDataType HexRecord::getData(HexDataSizeType index) const
 {
-    if (index < data.size())
-        return data.at(index);
+    if (index < dataSize)
+        return data[index];
     else
         return DEFAULT_HEX_RECORD_DATA_VALUE;
 }
@@ -412,15 +423,15 @@ HexDataType HexRecord::getData(HexDataSizeType index) const
 HexDataSizeType HexRecord::getData(HexDataType* data, HexDataSizeType dataSize, HexDataSizeType offset) const
 {
     // No data
-    if (this->data.size() == 0)
+    if (this->dataSize == 0)
         return 0;
 
     // Offset range check
-    if ((offset + dataSize) > this->data.size())
+    if ((offset + dataSize) > this->dataSize)
         throw std::out_of_range("dataSize and/or offset out of range");
 
     // Limit size
-    auto size{std::min(dataSize, this->data.size() - offset)};
+    auto size{std::min(dataSize, this->dataSize - offset)};
 
     // Copy data
     for (HexDataSizeType index{0}; index < size; ++index)
@@ -433,11 +444,11 @@ HexDataSizeType HexRecord::getData(HexDataType* data, HexDataSizeType dataSize,
 HexDataSizeType HexRecord::getData(HexDataVector& data, HexDataSizeType dataSize, HexDataSizeType inOffset, HexDataSizeType outOffset) const
 {
     // No data
-    if (this->data.size() == 0)
+    if (this->dataSize == 0)
         return 0;
 
     // Input offset range check
-    if ((inOffset + dataSize) > this->data.size())
+    if ((inOffset + dataSize) > this->dataSize)
         throw std::out_of_range("dataSize and/or inOffset out of range");
 
     // Output offset range check
@@ -445,7 +456,7 @@ HexDataSizeType HexRecord::getData(HexDataVector& data, HexDataSizeType dataSize
         throw std::out_of_range("dataSize and/or outOffset out of range");
 
     // Limit input size
-    auto inputSize{std::min(dataSize, this->data.size() - inOffset)};
+    auto inputSize{std::min(dataSize, this->dataSize - inOffset)};
 
     // Limit output size
     auto outputSize{std::min(dataSize, data.size() - outOffset)};
@@ -463,7 +474,7 @@ HexDataSizeType HexRecord::getData(HexDataVector& data, HexDataSizeType dataSize
 
 void HexRecord::setData(HexDataSizeType index, HexDataType data)
 {
-    if (index < this->data.size())
+    if (index < this->dataSize)
         this->data.at(index) = data;
 
     updateChecksum();
@@ -472,15 +483,15 @@ void HexRecord::setData(HexDataSizeType index, HexDataType data)
 HexDataSizeType HexRecord::setData(const HexDataType* data, HexDataSizeType dataSize, HexDataSizeType offset)
 {
     // No data
-    if (this->data.size() == 0)
+    if (this->dataSize == 0)
         return 0;
 
     // Offset range check
-    if ((offset + dataSize) > this->data.size())
+    if ((offset + dataSize) > this->dataSize)
         throw std::out_of_range("dataSize and/or offset out of range");
 
     // Limit size
-    auto size{std::min(dataSize, this->data.size() - offset)};
+    auto size{std::min(dataSize, this->dataSize - offset)};
 
     // Copy data
     for (HexDataSizeType index{0}; index < size; ++index)
@@ -494,7 +505,7 @@ HexDataSizeType HexRecord::setData(const HexDataType* data, HexDataSizeType data
 HexDataSizeType HexRecord::setData(const HexDataVector& data, HexDataSizeType dataSize, HexDataSizeType inOffset, HexDataSizeType outOffset)
 {
     // No data
-    if (this->data.size() == 0)
+    if (this->dataSize == 0)
         return 0;
 
     // Input offset range check
@@ -502,14 +513,14 @@ HexDataSizeType HexRecord::setData(const HexDataVector& data, HexDataSizeType da
         throw std::out_of_range("dataSize and/or inOffset out of range");
 
     // Output offset range check
-    if ((outOffset + dataSize) > this->data.size())
+    if ((outOffset + dataSize) > this->dataSize)
         throw std::out_of_range("dataSize and/or outOffset out of range");
 
     // Limit input size
     auto inputSize{std::min(dataSize, data.size() - inOffset)};
 
     // Limit output size
-    auto outputSize{std::min(dataSize, this->data.size() - outOffset)};
+    auto outputSize{std::min(dataSize, this->dataSize - outOffset)};
 
     // Limit size
     auto size{std::min(inputSize, outputSize)};
@@ -539,25 +550,30 @@ bool HexRecord::isValidRecord() const
 }
 
 bool HexRecord::isValidRecord(HexRecordType recordType) const
+{
+    return isValidRecord(recordType, dataSize, address);
+}
+
+bool HexRecord::isValidRecord(HexRecordType recordType, HexDataSizeType dataSize, HexDataAddressType address)
 {
     switch (recordType)
     {
         case HexRecordType::RECORD_DATA:
-            return (data.size() > 0);
+            return (dataSize > 0);
             break;
 
         case HexRecordType::RECORD_END_OF_FILE:
-            return (data.size() == 0);
+            return (dataSize == 0);
             break;
 
         case HexRecordType::RECORD_EXTENDED_SEGMENT_ADDRESS:
         case HexRecordType::RECORD_EXTENDED_LINEAR_ADDRESS:
-            return (data.size() == 2);
+            return (dataSize == 2);
             break;
 
         case HexRecordType::RECORD_START_SEGMENT_ADDRESS:
         case HexRecordType::RECORD_START_LINEAR_ADDRESS:
-            return ((data.size() == 4) && (address == 0));
+            return ((dataSize == 4) && (address == 0));
             break;
 
         default:
@@ -701,4 +717,112 @@ bool HexRecord::setStartLinearAddressExtendedInstructionPointer(uint32_t extende
     return result;
 }
 
+HexRecordView::HexRecordView() :
+    HexRecordView{0, HexRecordType::RECORD_END_OF_FILE, nullptr, 0}
+{
+}
+
+HexRecordView::HexRecordView(HexDataAddressType address, HexRecordType recordType, const HexDataType* data, HexDataSizeType dataSize) :
+    HexRecordView{address, recordType, data, dataSize, 0}
+{
+    // Size of the record
+    auto sum{static_cast<HexDataType>(dataSize)};
+
+    // Address of the record
+    sum += ((address >> 8) & 0xFF);
+    sum += ((address & 0xFF));
+
+    // Type of the record
+    sum += static_cast<HexDataType>(recordType);
+
+    // Data of the record
+    for (HexDataSizeType index{0}; index < dataSize; ++index)
+        sum += data[index];
+
+    // Checksum of the record, 2's complement
+    checksum = static_cast<HexDataType>(-static_cast<int>(sum));
+}
+
+HexRecordView::HexRecordView(HexDataAddressType address, HexRecordType recordType, const HexDataType* data, HexDataSizeType dataSize, HexDataType checksum) :
+    address{address},
+    recordType{recordType},
+    data{data},
+    dataSize{dataSize},
+    checksum{checksum}
+{
+    if (dataSize > MAXIMUM_HEX_RECORD_DATA_SIZE)
+        throw std::out_of_range("Data size is out of range");
+}
+
+HexDataAddressType HexRecordView::getAddress() const
+{
+    return address;
+}
+
+HexRecordType HexRecordView::getRecordType() const
+{
+    return recordType;
+}
+
+const HexDataType* HexRecordView::getData() const
+{
+    return data;
+}
+
+HexDataType HexRecordView::getData(HexDataSizeType index) const
+{
+    if (index >= dataSize)
+        throw std::out_of_range("Index out of range");
+
+    return data[index];
+}
+
+HexDataSizeType HexRecordView::getDataSize() const
+{
+    return dataSize;
+}
+
+HexDataType HexRecordView::getChecksum() const
+{
+    return checksum;
+}
+
+HexDataSizeType HexRecordView::getRecordLength() const
+{
+    return (11 + (2 * dataSize));
+}
+
+std::string HexRecordView::getRecord() const
+{
+    std::string result;
+    encode(result);
+    return result;
+}
+
+HexDataSizeType HexRecordView::encode(char* record) const
+{
+    // Start of the record character
+    record[0] = START_OF_HEX_RECORD_CHARACTER;
+
+    // Size, address and type of the record
+    HexCodec::encodeByte(static_cast<HexDataType>(dataSize), record + 1);
+    HexCodec::encodeWord(address, record + 3);
+    HexCodec::encodeByte(static_cast<HexDataType>(recordType), record + 7);
+
+    // Data of the record
+    HexCodec::encode(data, dataSize, record + 9);
+
+    // Checksum of the record
+    const auto length{getRecordLength()};
+    HexCodec::encodeByte(checksum, record + length - 2);
+    return length;
+}
+
+HexDataSizeType HexRecordView::encode(std::string& record) const
+{
+    const auto offset{record.size()};
+    record.resize(offset + getRecordLength());
+    return encode(record.data() + offset);
+}
+
 END_NAMESPACE_LIBIHEX
@@ -20,21 +20,47 @@
 */
 
 #include <algorithm>
+#include <atomic>
 #include <stdexcept>
+#include <memory>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <ihex/hex_address.hpp>
 #include <ihex/hex_section.hpp>
 
 BEGIN_NAMESPACE_LIBIHEX
 
+namespace
+{
+    /**
+     * @brief Get the next unique section revision
+     *
+     * @return uint64_t Revision
+     */
+    uint64_t nextRevision()
+    {
+        static std::atomic<uint64_t> revision{0};
+        return ++revision;
+    }
+}
+
 HexSection::HexSection() :
-    section{}, blocks{}, unusedDataFillValue{DEFAULT_HEX_RECORD_DATA_VALUE}, defaultDataSize{DEFAULT_HEX_RECORD_DATA_SIZE}
+    HexSection{allocator_type{}}
+{
+
+}
+
+HexSection::HexSection(const allocator_type& allocator) :
+    section{}, blocks{getEmptyBlocks()}, unusedDataFillValue{DEFAULT_HEX_RECORD_DATA_VALUE}, defaultDataSize{DEFAULT_HEX_RECORD_DATA_SIZE},
+    revision{nextRevision()}, storageType{HexSectionStorageType::STORAGE_BLOCKS}, page{getEmptyPage()}, referenced{false}, blockCursor{std::string::npos},
+    allocator{allocator}
 {
 
 }
 
 HexSection::HexSection(const std::string& record) :
-    section{}, blocks{}, unusedDataFillValue{DEFAULT_HEX_RECORD_DATA_VALUE}, defaultDataSize{DEFAULT_HEX_RECORD_DATA_SIZE}
+    HexSection{allocator_type{}}
 {
     // Parse initial record
     HexRecord initial{record};
@@ -44,7 +70,7 @@ HexSection::HexSection(const std::string& record) :
 }
 
 HexSection::HexSection(const HexRecord& record) :
-    section{}, blocks{}, unusedDataFillValue{DEFAULT_HEX_RECORD_DATA_VALUE}, defaultDataSize{DEFAULT_HEX_RECORD_DATA_SIZE}
+    HexSection{allocator_type{}}
 {
     // Check record checksum
     if (!record.isValidChecksum())
@@ -55,7 +81,13 @@ HexSection::HexSection(const HexRecord& record) :
 }
 
 HexSection::HexSection(HexSectionType sectionType) :
-    section{}, blocks{}, unusedDataFillValue{DEFAULT_HEX_RECORD_DATA_VALUE}, defaultDataSize{DEFAULT_HEX_RECORD_DATA_SIZE}
+    HexSection{sectionType, allocator_type{}}
+{
+
+}
+
+HexSection::HexSection(HexSectionType sectionType, const allocator_type& allocator) :
+    HexSection{allocator}
 {
     // Configure HexSection depending on the section type
     switch (sectionType)
@@ -88,12 +120,100 @@ HexSection::HexSection(HexSectionType sectionType) :
 }
 
 HexSection::HexSection(const HexSection& section) :
+    HexSection{section, allocator_type{}}
+{
+
+}
+
+HexSection::HexSection(const HexSection& section, const allocator_type& allocator) :
     section{section.section},
-    blocks{section.blocks},
+    blocks{section.shareBlocks(allocator)},
+    unusedDataFillValue{section.unusedDataFillValue},
+    defaultDataSize{section.defaultDataSize},
+    revision{section.referenced ? nextRevision() : section.revision},
+    storageType{section.storageType},
+    page{section.sharePage(allocator)},
+    referenced{false},
+    blockCursor{std::string::npos},
+    allocator{allocator}
+{
+
+}
+
+HexSection::HexSection(HexSection&& section) noexcept :
+    section{std::move(section.section)},
+    blocks{std::move(section.blocks)},
+    unusedDataFillValue{section.unusedDataFillValue},
+    defaultDataSize{section.defaultDataSize},
+    revision{section.revision},
+    storageType{section.storageType},
+    page{std::move(section.page)},
+    referenced{section.referenced},
+    blockCursor{std::string::npos},
+    allocator{section.allocator}
+{
+    // Data of the moved section now belongs to this section
+    section.resetData();
+}
+
+HexSection::HexSection(HexSection&& section, const allocator_type& allocator) :
+    section{std::move(section.section)},
+    blocks{(allocator == section.allocator) ? std::move(section.blocks) : section.shareBlocks(allocator)},
     unusedDataFillValue{section.unusedDataFillValue},
-    defaultDataSize{section.defaultDataSize}
+    defaultDataSize{section.defaultDataSize},
+    revision{section.revision},
+    storageType{section.storageType},
+    page{(allocator == section.allocator) ? std::move(section.page) : section.sharePage(allocator)},
+    referenced{section.referenced && (allocator == section.allocator)},
+    blockCursor{std::string::npos},
+    allocator{allocator}
 {
+    // Data of the moved section is either taken over or copied
+    section.resetData();
+}
+
+HexSection& HexSection::operator=(const HexSection& section)
+{
+    if (this != &section)
+    {
+        // Allocator of the section is kept
+        this->section = section.section;
+        blocks = section.shareBlocks(allocator);
+        unusedDataFillValue = section.unusedDataFillValue;
+        defaultDataSize = section.defaultDataSize;
+        revision = section.referenced ? nextRevision() : section.revision;
+        storageType = section.storageType;
+        page = section.sharePage(allocator);
+        referenced = false;
+        resetBlockCursor();
+    }
+
+    return *this;
+}
+
+HexSection& HexSection::operator=(HexSection&& section)
+{
+    if (this != &section)
+    {
+        // Allocator of the section is kept
+        this->section = std::move(section.section);
+        blocks = (allocator == section.allocator) ? std::move(section.blocks) : section.shareBlocks(allocator);
+        unusedDataFillValue = section.unusedDataFillValue;
+        defaultDataSize = section.defaultDataSize;
+        revision = section.revision;
+        storageType = section.storageType;
+        page = (allocator == section.allocator) ? std::move(section.page) : section.sharePage(allocator);
+        referenced = section.referenced && (allocator == section.allocator);
+        resetBlockCursor();
+        section.resetData();
+    }
+
+    return *this;
+}
 
+HexSection::allocator_type HexSection::get_allocator() const
+{
+    return allocator;
 }
 
 HexDataType HexSection::operator[](HexDataAddressType address) const
@@ -103,22 +223,27 @@ HexDataType HexSection::operator[](HexDataAddressType address) const
         case HexSectionType::SECTION_DATA:
         case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
         case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
-            for (auto it{blocks.crbegin()}; it != blocks.crend(); ++it)
+        {
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
             {
-                if (it->first <= address)
-                {
-                    // The condition above guarantees the difference will always be positive
-                    const auto index{static_cast<size_t>(address - it->first)};
-                    if (index < it->second.size())
-                        return it->second[index];
+                if (page->hasData(address))
+                    return page->getData()[address];
 
-                    // Address is below the address of the block
-                    break;
-                }
+                throw std::out_of_range("Address does not exist");
+            }
+
+            const auto it{findBlock(address)};
+            if (it != blocks->end())
+            {
+                // Block starts at or before the address so the difference will always be positive
+                const auto index{static_cast<size_t>(address - it->first)};
+                if (index < it->second.size())
+                    return it->second[index];
             }
 
             throw std::out_of_range("Address does not exist");
             break;
+        }
 
         case HexSectionType::SECTION_END_OF_FILE:
         case HexSectionType::SECTION_START_SEGMENT_ADDRESS:
@@ -131,27 +256,39 @@ HexDataType HexSection::operator[](HexDataAddressType address) const
 
 HexDataType& HexSection::operator[](HexDataAddressType address)
 {
+    touch();
+    unshareData();
+
+    // The caller may write the data through the reference at any time,
+    // so it can't be shared with the copies of the section anymore
+    referenced = true;
+
     switch (getSectionType())
     {
         case HexSectionType::SECTION_DATA:
         case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
         case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
-            for (auto it{blocks.rbegin()}; it != blocks.rend(); ++it)
+        {
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
             {
-                if (it->first <= address)
-                {
-                    // The condition above guarantees the difference will always be positive
-                    const auto index{static_cast<size_t>(address - it->first)};
-                    if (index < it->second.size())
-                        return it->second[index];
+                if (page->hasData(address))
+                    return page->getData()[address];
 
-                    // Address is below the address of the block
-                    break;
-                }
+                throw std::out_of_range("Address does not exist");
+            }
+
+            const auto it{findBlock(address)};
+            if (it != blocks->end())
+            {
+                // Block starts at or before the address so the difference will always be positive
+                const auto index{static_cast<size_t>(address - it->first)};
+                if (index < it->second.size())
+                    return it->second[index];
             }
 
             throw std::out_of_range("Address does not exist");
             break;
+        }
 
         case HexSectionType::SECTION_END_OF_FILE:
         case HexSectionType::SECTION_START_SEGMENT_ADDRESS:
@@ -315,6 +452,8 @@ HexSectionType HexSection::getSectionType() const
 
 void HexSection::convertToDataSection()
 {
+    touch();
+
     // Change to an unused dummy RECORD_DATA
     HexDataType data{0};
     section.prepareDataRecord(0, &data, 1);
@@ -322,35 +461,45 @@ void HexSection::convertToDataSection()
 
 void HexSection::convertToEndOfFileSection()
 {
+    touch();
+
     // Change to a RECORD_END_OF_FILE and clear all data blocks
     section.prepareEndOfFileRecord();
-    blocks.clear();
+    resetData();
 }
 
 void HexSection::convertToExtendedSegmentAddressSection(uint16_t segmentAddress)
 {
+    touch();
+
     // Change to a RECORD_EXTENDED_SEGMENT_ADDRESS
     section.prepareExtendedSegmentAddressRecord(segmentAddress);
 }
 
 void HexSection::convertToStartSegmentAddressSection(uint16_t codeSegment, uint16_t instructionPointer)
 {
+    touch();
+
     // Change to a RECORD_START_SEGMENT_ADDRESS and clear all data blocks
     section.prepareStartSegmentAddressRecord(codeSegment, instructionPointer);
-    blocks.clear();
+    resetData();
 }
 
 void HexSection::convertToExtendedLinearAddressSection(uint16_t linearAddress)
 {
+    touch();
+
     // Change to a RECORD_EXTENDED_LINEAR_ADDRESS
     section.prepareExtendedLinearAddressRecord(linearAddress);
 }
 
 void HexSection::convertToStartLinearAddressSection(uint32_t extendedInstructionPointer)
 {
+    touch();
+
     // Change to a RECORD_START_LINEAR_ADDRESS and clear all data blocks
     section.prepareStartLinearAddressRecord(extendedInstructionPointer);
-    blocks.clear();
+    resetData();
 }
 
 uint16_t HexSection::getExtendedSegmentAddress() const
@@ -360,6 +509,8 @@ uint16_t HexSection::getExtendedSegmentAddress() const
 
 bool HexSection::setExtendedSegmentAddress(uint16_t segmentAddress)
 {
+    touch();
+
     return section.setExtendedSegmentAddress(segmentAddress);
 }
 
@@ -370,6 +521,8 @@ uint16_t HexSection::getStartSegmentAddressCodeSegment() const
 
 bool HexSection::setStartSegmentAddressCodeSegment(uint16_t codeSegment)
 {
+    touch();
+
     return section.setStartSegmentAddressCodeSegment(codeSegment);
 }
 
@@ -380,6 +533,8 @@ uint16_t HexSection::getStartSegmentAddressInstructionPointer() const
 
 bool HexSection::setStartSegmentAddressInstructionPointer(uint16_t instructionPointer)
 {
+    touch();
+
     return section.setStartSegmentAddressInstructionPointer(instructionPointer);
 }
 
@@ -390,6 +545,8 @@ uint16_t HexSection::getExtendedLinearAddress() const
 
 bool HexSection::setExtendedLinearAddress(uint16_t linearAddress)
 {
+    touch();
+
     return section.setExtendedLinearAddress(linearAddress);
 }
 
@@ -400,6 +557,8 @@ uint32_t HexSection::getStartLinearAddressExtendedInstructionPointer() const
 
 bool HexSection::setStartLinearAddressExtendedInstructionPointer(uint32_t extendedInstructionPointer)
 {
+    touch();
+
     return section.setStartLinearAddressExtendedInstructionPointer(extendedInstructionPointer);
 }
 
@@ -459,7 +618,17 @@ HexAddressMap HexSection::getDataMap() const
 
     // Fill all records' absolute addresses and sizes into the result
     HexAddressMap result{};
-    for (auto it{blocks.cbegin()}; it != blocks.cend(); ++it)
+    if (storageType == HexSectionStorageType::STORAGE_PAGE)
+    {
+        HexDataSizeType recordAddress{0};
+        HexDataSizeType runEnd{0};
+        for (auto size{findPageRecord(recordAddress, runEnd)}; size > 0; recordAddress += size, size = findPageRecord(recordAddress, runEnd))
+            result[address.getAbsoluteAddress(static_cast<HexDataAddressType>(recordAddress))] = size;
+
+        return result;
+    }
+
+    for (auto it{blocks->cbegin()}; it != blocks->cend(); ++it)
         result[address.getAbsoluteAddress(it->first)] = it->second.size();
 
     // Return result
@@ -472,14 +641,20 @@ size_t HexSection::getSize() const
     {
         // Size of the section is size of all the blocks
         case HexSectionType::SECTION_DATA:
-            return blocks.size();
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
+                return countPageRecords(HEX_PAGE_SIZE);
+
+            return blocks->size();
             break;
 
         // Size of the section is size of all the blocks including
         // the section record
         case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
         case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
-            return (blocks.size() + 1);
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
+                return (countPageRecords(HEX_PAGE_SIZE) + 1);
+
+            return (blocks->size() + 1);
             break;
 
         // Section contains a single record
@@ -500,7 +675,10 @@ bool HexSection::hasData() const
         case HexSectionType::SECTION_DATA:
         case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
         case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
-            return (blocks.size() > 0);
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
+                return page->hasData();
+
+            return (blocks->size() > 0);
             break;
 
         // Sections without data
@@ -521,8 +699,11 @@ HexDataSizeType HexSection::getDataSize() const
         case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
         case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
         {
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
+                return page->getDataSize();
+
             HexDataSizeType result{0};
-            for (const auto& block : blocks)
+            for (const auto& block : *blocks)
                 result += block.second.size();
 
             return result;
@@ -545,6 +726,8 @@ HexDataType HexSection::getUnusedDataFillValue() const
 
 void HexSection::setUnusedDataFillValue(HexDataType unusedDataFillValue)
 {
+    touch();
+
     this->unusedDataFillValue = unusedDataFillValue;
 }
 
@@ -555,12 +738,56 @@ HexDataSizeType HexSection::getDefaultDataSize() const
 
 void HexSection::setDefaultDataSize(HexDataSizeType defaultDataSize)
 {
+    touch();
+
     if (defaultDataSize <= 1)
         throw std::out_of_range("Default data size must be greater than one");
 
     this->defaultDataSize = defaultDataSize;
 }
 
+HexSectionStorageType HexSection::getStorageType() const
+{
+    return storageType;
+}
+
+void HexSection::setStorageType(HexSectionStorageType storageType)
+{
+    if ((storageType < HexSectionStorageType::STORAGE_MIN) || (storageType > HexSectionStorageType::STORAGE_MAX))
+        throw std::invalid_argument("Storage type is not valid");
+
+    if (storageType == this->storageType)
+        return;
+
+    touch();
+
+    if (storageType == HexSectionStorageType::STORAGE_PAGE)
+    {
+        // Move the data blocks to a new page
+        auto converted{std::allocate_shared<HexPage>(allocator)};
+        for (const auto& block : *blocks)
+            converted->setData(block.first, block.second.data(), block.second.size());
+
+        resetData();
+        page = std::move(converted);
+    }
+    else
+    {
+        // Split the contiguous data of the page to new data blocks
+        auto converted{std::allocate_shared<HexDataBlockVector>(allocator)};
+        HexDataSizeType address{0};
+        HexDataSizeType runEnd{0};
+        for (auto size{findPageRecord(address, runEnd)}; size > 0; address += size, size = findPageRecord(address, runEnd))
+            converted->emplace_back(std::piecewise_construct, std::forward_as_tuple(static_cast<HexDataAddressType>(address)), std::forward_as_tuple(page->getData() + address, page->getData() + address + size));
+
+        resetData();
+        blocks = std::move(converted);
+        resetBlockCursor();
+    }
+
+    this->storageType = storageType;
+}
+
 bool HexSection::getRecord(HexRecord& record, size_t index) const
 {
     switch (getSectionType())
@@ -587,11 +814,16 @@ bool HexSection::getRecord(HexRecord& record, size_t index) const
                 record = section;
                 return true;
             }
-            else if (index <= blocks.size())
+            else if (storageType == HexSectionStorageType::STORAGE_PAGE)
+            {
+                // Make a data record of the page
+                return getPageRecord(record, index - 1);
+            }
+            else if (index <= blocks->size())
             {
                 // Make a data record
-                const auto it{std::next(blocks.cbegin(), index - 1)};
-                record.prepareDataRecord(it->first, it->second);
+                const auto it{std::next(blocks->cbegin(), index - 1)};
+                record.prepareDataRecord(it->first, it->second.data(), it->second.size());
                 return true;
             }
             break;
@@ -600,11 +832,16 @@ bool HexSection::getRecord(HexRecord& record, size_t index) const
         case HexSectionType::SECTION_DATA:
         default:
         {
-            if ((blocks.size() > 0) && (index < blocks.size()))
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
+            {
+                // Make a data record of the page
+                return getPageRecord(record, index);
+            }
+            else if ((blocks->size() > 0) && (index < blocks->size()))
             {
                 // Make a data record
-                const auto it{std::next(blocks.cbegin(), index)};
-                record.prepareDataRecord(it->first, it->second);
+                const auto it{std::next(blocks->cbegin(), index)};
+                record.prepareDataRecord(it->first, it->second.data(), it->second.size());
                 return true;
             }
             break;
@@ -634,6 +871,265 @@ HexRecord HexSection::getRecord(size_t index) const
     return record;
 }
 
+uint64_t HexSection::getRevision() const
+{
+    return revision;
+}
+
+bool HexSection::isDataReferenced() const
+{
+    return referenced;
+}
+
+void HexSection::touch()
+{
+    revision = nextRevision();
+}
+
+HexSection::HexDataBlockVector::const_iterator HexSection::findBlock(HexDataAddressType address) const
+{
+    // Check the block of the last lookup and the one following it first
+    const auto cursor{blockCursor.load(std::memory_order_relaxed)};
+    if ((cursor < blocks->size()) && ((*blocks)[cursor].first <= address))
+    {
+        const auto next{cursor + 1};
+        if ((next == blocks->size()) || ((*blocks)[next].first > address))
+            return std::next(blocks->cbegin(), static_cast<std::ptrdiff_t>(cursor));
+
+        const auto following{next + 1};
+        if ((following == blocks->size()) || ((*blocks)[following].first > address))
+        {
+            blockCursor.store(next, std::memory_order_relaxed);
+            return std::next(blocks->cbegin(), static_cast<std::ptrdiff_t>(next));
+        }
+    }
+
+    // Block before the first block starting after the address
+    const auto it{std::upper_bound(blocks->cbegin(), blocks->cend(), address, [](HexDataAddressType value, const HexDataBlock& block) { return value < block.first; })};
+    if (it == blocks->cbegin())
+        return blocks->cend();
+
+    blockCursor.store(static_cast<size_t>(std::distance(blocks->cbegin(), it)) - 1, std::memory_order_relaxed);
+    return std::prev(it);
+}
+
+HexSection::HexDataBlockVector::iterator HexSection::findBlock(HexDataAddressType address)
+{
+    const auto it{static_cast<const HexSection*>(this)->findBlock(address)};
+
+    // Erasing an empty range converts the iterator without modifying the blocks
+    return blocks->erase(it, it);
+}
+
+HexSection::HexDataBlockVector::const_iterator HexSection::findNextBlock(HexDataAddressType address) const
+{
+    // First block if there is no block at or before the address
+    auto it{findBlock(address)};
+    if (it == blocks->cend())
+        return blocks->cbegin();
+
+    // Following block if the address is after the block
+    if ((it->first + it->second.size()) <= address)
+        ++it;
+
+    return it;
+}
+
+HexSection::HexDataBlockVector::iterator HexSection::findNextBlock(HexDataAddressType address)
+{
+    const auto it{static_cast<const HexSection*>(this)->findNextBlock(address)};
+
+    // Erasing an empty range converts the iterator without modifying the blocks
+    return blocks->erase(it, it);
+}
+
+HexSection::HexDataBlockVector::iterator HexSection::emplaceBlock(HexDataAddressType address)
+{
+    // First block starting at or after the address
+    const auto it{std::lower_bound(blocks->begin(), blocks->end(), address, [](const HexDataBlock& block, HexDataAddressType value) { return block.first < value; })};
+    if ((it != blocks->end()) && (it->first == address))
+        return it;
+
+    return blocks->emplace(it, std::piecewise_construct, std::forward_as_tuple(address), std::forward_as_tuple());
+}
+
+void HexSection::pushData(HexDataAddressType address, const HexDataType* data, HexDataSizeType dataSize)
+{
+    // Addresses past the end of the section wrap around to its beginning
+    const HexDataSizeType wrapSize{std::min(dataSize, static_cast<HexDataSizeType>(MAXIMUM_HEX_RECORD_ADDRESS) + 1 - address)};
+    if (wrapSize < dataSize)
+    {
+        pushData(address, data, wrapSize);
+        pushData(0, data + wrapSize, dataSize - wrapSize);
+        return;
+    }
+
+    unshareData();
+
+    if (storageType == HexSectionStorageType::STORAGE_PAGE)
+    {
+        page->setData(address, data, dataSize);
+        return;
+    }
+
+    HexDataSizeType offset{0};
+    while (offset < dataSize)
+    {
+        const auto current{static_cast<HexDataSizeType>(address) + offset};
+        auto it{findBlock(static_cast<HexDataAddressType>(current))};
+
+        // First block after the current address
+        const auto next{(it == blocks->end()) ? blocks->begin() : std::next(it)};
+        const HexDataSizeType nextSize{(next == blocks->end()) ? (dataSize - offset) : (next->first - current)};
+
+        if (it != blocks->end())
+        {
+            // Block starts at or before the address so the difference will always be positive
+            const auto index{static_cast<HexDataSizeType>(current - it->first)};
+            if (index < it->second.size())
+            {
+                // Overwrite the data of the block
+                const auto size{std::min((dataSize - offset), (it->second.size() - index))};
+                std::copy(data + offset, data + offset + size, it->second.begin() + index);
+                offset += size;
+                continue;
+            }
+            else if ((index == it->second.size()) && ((it->second.size() % defaultDataSize) != 0))
+            {
+                // Append to the block up to the multiple of the default size
+                const auto size{std::min({(dataSize - offset), (defaultDataSize - (it->second.size() % defaultDataSize)), nextSize})};
+                it->second.insert(it->second.end(), data + offset, data + offset + size);
+                offset += size;
+                continue;
+            }
+        }
+
+        // Create new block of up to the default size
+        const auto size{std::min({(dataSize - offset), defaultDataSize, nextSize})};
+        blocks->emplace(next, std::piecewise_construct, std::forward_as_tuple(static_cast<HexDataAddressType>(current)), std::forward_as_tuple(data + offset, data + offset + size));
+        offset += size;
+    }
+}
+
+void HexSection::unshareData()
+{
+    // Copy the data of the used storage if it is shared with other sections
+    if (storageType == HexSectionStorageType::STORAGE_PAGE)
+    {
+        if (page.use_count() > 1)
+            page = std::allocate_shared<HexPage>(allocator, *page);
+    }
+    else if (blocks.use_count() > 1)
+    {
+        blocks = std::allocate_shared<HexDataBlockVector>(allocator, *blocks);
+        resetBlockCursor();
+    }
+}
+
+void HexSection::resetData()
+{
+    blocks = getEmptyBlocks();
+    page = getEmptyPage();
+    referenced = false;
+    resetBlockCursor();
+}
+
+std::shared_ptr<HexSection::HexDataBlockVector> HexSection::shareBlocks(const allocator_type& allocator) const
+{
+    // Copy the data blocks if the allocators differ or the data is referenced (the empty blocks are always shared)
+    if (((allocator == this->allocator) && !referenced) || (blocks == getEmptyBlocks()))
+        return blocks;
+
+    return std::allocate_shared<HexDataBlockVector>(allocator, *blocks);
+}
+
+std::shared_ptr<HexPage> HexSection::sharePage(const allocator_type& allocator) const
+{
+    // Copy the page if the allocators differ or the data is referenced (the empty page is always shared)
+    if (((allocator == this->allocator) && !referenced) || (page == getEmptyPage()))
+        return page;
+
+    return std::allocate_shared<HexPage>(allocator, *page);
+}
+
+const std::shared_ptr<HexSection::HexDataBlockVector>& HexSection::getEmptyBlocks()
+{
+    // Never modified, sections copy it before adding any data
+    static const std::shared_ptr<HexDataBlockVector> emptyBlocks{std::make_shared<HexDataBlockVector>()};
+    return emptyBlocks;
+}
+
+const std::shared_ptr<HexPage>& HexSection::getEmptyPage()
+{
+    // Never modified, sections copy it before adding any data
+    static const std::shared_ptr<HexPage> emptyPage{std::make_shared<HexPage>()};
+    return emptyPage;
+}
+
+void HexSection::resetBlockCursor() const
+{
+    blockCursor.store(std::string::npos, std::memory_order_relaxed);
+}
+
+HexDataSizeType HexSection::findPageRecord(HexDataSizeType& address, HexDataSizeType& runEnd) const
+{
+    // Find the next contiguous data after the end of the previous one
+    if (address >= runEnd)
+    {
+        address = page->findData(address);
+        if (address >= HEX_PAGE_SIZE)
+            return 0;
+
+        runEnd = page->findGap(address);
+    }
+
+    // Split the contiguous data to the default data size
+    return std::min(defaultDataSize, runEnd - address);
+}
+
+size_t HexSection::countPageRecords(HexDataSizeType address) const
+{
+    size_t result{0};
+    HexDataSizeType recordAddress{0};
+    HexDataSizeType runEnd{0};
+    for (auto size{findPageRecord(recordAddress, runEnd)}; (size > 0) && (recordAddress < address); recordAddress += size, size = findPageRecord(recordAddress, runEnd))
+        result++;
+
+    return result;
+}
+
+bool HexSection::getPageRecord(HexRecord& record, size_t index) const
+{
+    HexDataSizeType address{0};
+    HexDataSizeType runEnd{0};
+    for (auto size{findPageRecord(address, runEnd)}; size > 0; address += size, size = findPageRecord(address, runEnd))
+    {
+        if (index-- == 0)
+        {
+            // Make a data record
+            record.prepareDataRecord(static_cast<HexDataAddressType>(address), page->getData() + address, size);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+HexRecordIterator HexSection::begin() const
+{
+    return HexRecordIterator{*this};
+}
+
+HexRecordIterator HexSection::begin(HexDataSizeType recordDataSize, HexDataSizeType recordAlignment) const
+{
+    return HexRecordIterator{*this, false, recordDataSize, recordAlignment};
+}
+
+HexRecordIterator HexSection::end() const
+{
+    return HexRecordIterator{*this, true};
+}
+
 bool HexSection::canPushRecord(const HexRecord& record) const
 {
     if (!record.isValidChecksum())
@@ -658,7 +1154,7 @@ bool HexSection::canPushRecord(const HexRecord& record) const
                     // If record is any other record than RECORD_DATA and
                     // section is empty SECTION_DATA, then allow pushing by
                     // setting the section to the new type
-                    return (blocks.size() == 0);
+                    return !hasData();
                     break;
 
                 default:
@@ -693,6 +1189,8 @@ bool HexSection::canPushRecord(const std::string& record) const
 
 bool HexSection::pushRecord(const HexRecord& record)
 {
+    touch();
+
     if (!record.isValidChecksum())
         return false;
 
@@ -705,8 +1203,7 @@ bool HexSection::pushRecord(const HexRecord& record)
                 case HexRecordType::RECORD_DATA:
                 {
                     // Can push RECORD_DATA to SECTION_DATA
-                    for (size_t index{0}; index < record.getDataSize(); ++index)
-                        setData(record.getAddress() + static_cast<HexDataAddressType>(index), record.getData(index));
+                    pushData(record.getAddress(), record.getData(), record.getDataSize());
 
                     return true;
                     break;
@@ -721,7 +1218,7 @@ bool HexSection::pushRecord(const HexRecord& record)
                     // If record is any other record than RECORD_DATA and
                     // section is empty SECTION_DATA, then allow pushing by
                     // setting the section to the new type
-                    const bool canPush{(blocks.size() == 0)};
+                    const bool canPush{!hasData()};
                     if (canPush)
                         section = record;
 
@@ -743,10 +1240,8 @@ bool HexSection::pushRecord(const HexRecord& record)
             // Only allow pushing of data records
             const bool canPush{(record.getRecordType() == HexRecordType::RECORD_DATA)};
             if (canPush)
-            {
-                for (size_t index{0}; index < record.getDataSize(); ++index)
-                    setData(record.getAddress() + static_cast<HexDataAddressType>(index), record.getData(index));
-            }
+                pushData(record.getAddress(), record.getData(), record.getDataSize());
+
             return canPush;
             break;
         }
@@ -793,11 +1288,15 @@ HexDataAddressType HexSection::getLowerAddress() const
         throw std::domain_error("Section does not support addresses");
 
     // Does section have any data?
-    if (blocks.size() == 0)
+    if (!hasData())
         throw std::out_of_range("Section has no data");
 
+    // Return the first address of the page
+    if (storageType == HexSectionStorageType::STORAGE_PAGE)
+        return static_cast<HexDataAddressType>(page->findData(0));
+
     // Return address of the first address of the first block
-    return blocks.cbegin()->first;
+    return blocks->cbegin()->first;
 }
 
 HexDataAddressType HexSection::getUpperAddress() const
@@ -807,11 +1306,15 @@ HexDataAddressType HexSection::getUpperAddress() const
         throw std::domain_error("Section does not support addresses");
 
     // Does section have any data?
-    if (blocks.size() == 0)
+    if (!hasData())
         throw std::out_of_range("Section has no data");
 
+    // Return the last address of the page
+    if (storageType == HexSectionStorageType::STORAGE_PAGE)
+        return static_cast<HexDataAddressType>(page->findLastData());
+
     // Return address of the last block of the last address
-    const auto it{blocks.crbegin()};
+    const auto it{blocks->crbegin()};
     return (it->first + static_cast<HexDataAddressType>(it->second.size() - 1));
 }
 
@@ -980,20 +1483,19 @@ size_t HexSection::findAddress(HexDataAddressType address) const
         case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
         case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
         {
-            for (auto it{blocks.crbegin()}; it != blocks.crend(); ++it)
+            // Index of the last record starting at or before the address
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
+                return (page->hasData(address) ? (countPageRecords(static_cast<HexDataSizeType>(address) + 1) - 1) : std::string::npos);
+
+            const auto it{findBlock(address)};
+            if (it != blocks->cend())
             {
-                if (it->first <= address)
+                // Block starts at or before the address so the difference will always be positive
+                const auto index{static_cast<size_t>(address - it->first)};
+                if (index < it->second.size())
                 {
-                    // The condition above guarantees the difference will always be positive
-                    const auto index{static_cast<size_t>(address - it->first)};
-                    if (index < it->second.size())
-                    {
-                        // Return index from the beginning
-                        return (std::distance(it, blocks.crend()) - 1);
-                    }
-
-                    // Address is below the address of the block
-                    break;
+                    // Return index from the beginning
+                    return static_cast<size_t>(std::distance(blocks->cbegin(), it));
                 }
             }
 
@@ -1023,17 +1525,19 @@ size_t HexSection::findPreviousRecord(HexDataAddressType address) const
             if (address == 0)
                 return std::string::npos;
 
-            for (auto it{blocks.crbegin()}; it != blocks.crend(); ++it)
+            // Index of the last record starting before the address
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
             {
-                // Previous block is the one for which address is bigger than the first address of the block
-                if (address > it->first)
-                {
-                    // Return index from the beginning
-                    return (std::distance(it, blocks.crend()) - 1);
+                const auto count{countPageRecords(address)};
+                return ((count > 0) ? (count - 1) : std::string::npos);
+            }
 
-                    // Address is below the address of the block
-                    break;
-                }
+            // Previous block is the last one for which address is bigger than the first address of the block
+            const auto it{findBlock(address - 1)};
+            if (it != blocks->cend())
+            {
+                // Return index from the beginning
+                return static_cast<size_t>(std::distance(blocks->cbegin(), it));
             }
 
             // Previous address not found
@@ -1061,17 +1565,32 @@ size_t HexSection::findNextRecord(HexDataAddressType address) const
             if (address == MAXIMUM_HEX_RECORD_ADDRESS)
                 return std::string::npos;
 
-            for (auto it{blocks.cbegin()}; it != blocks.cend(); ++it)
+            // Index of the first record ending after the address
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
             {
-                // Next block is the one for which address is lower than the last address of the block
-                if (address < (it->first + it->second.size() - 1))
+                size_t index{0};
+                HexDataSizeType recordAddress{0};
+                HexDataSizeType runEnd{0};
+                for (auto size{findPageRecord(recordAddress, runEnd)}; size > 0; recordAddress += size, size = findPageRecord(recordAddress, runEnd), ++index)
                 {
-                    // Return index from the beginning
-                    return (std::distance(blocks.cbegin(), it));
-
-                    // Address is above the address of the block
-                    break;
+                    if (address < (recordAddress + size - 1))
+                        return index;
                 }
+
+                return std::string::npos;
+            }
+
+            // Next block is the first one for which address is lower than the last address of the block
+            auto it{findBlock(address)};
+            if (it == blocks->cend())
+                it = blocks->cbegin();
+            else if (address >= (it->first + it->second.size() - 1))
+                ++it;
+
+            if (it != blocks->cend())
+            {
+                // Return index from the beginning
+                return static_cast<size_t>(std::distance(blocks->cbegin(), it));
             }
 
             // Next address not found
@@ -1089,46 +1608,60 @@ size_t HexSection::findNextRecord(HexDataAddressType address) const
 
 void HexSection::clearData()
 {
-    blocks.clear();
+    touch();
+
+    resetData();
 }
 
 void HexSection::clearData(HexDataAddressType address)
 {
+    touch();
+    unshareData();
+
     switch (getSectionType())
     {
         case HexSectionType::SECTION_DATA:
         case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
         case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
         {
-            for (auto it{blocks.begin()}; it != blocks.end(); ++it)
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
             {
-                // Address is below the block
-                if (address < it->first)
-                    break;
-
-                // Address is above this block
-                const auto last{it->first + it->second.size()};
-                if (address >= last)
-                    continue;
+                page->clearData(address, 1);
+                break;
+            }
 
-                if ((last - address) > 1)
-                {
-                    // Start address of the new block
-                    const auto offset{address - it->first + 1};
+            // Address is below the first block
+            auto it{findBlock(address)};
+            if (it == blocks->end())
+                break;
 
-                    // Create new block and add trailing data
-                    blocks[address + 1].assign(it->second.cbegin() + offset, it->second.cend());
-                }
+            // Address is above this block
+            const auto last{it->first + it->second.size()};
+            if (address >= last)
+                break;
 
-                // Truncate or delete existing block
-                const auto size{address - it->first};
-                if (size > 0)
-                    it->second.resize(size);
-                else
-                    blocks.erase(it);
+            if ((last - address) > 1)
+            {
+                // Start address of the new block
+                const auto offset{address - it->first + 1};
+
+                // Create new block after the existing one and add trailing data
+                const auto position{std::distance(blocks->begin(), it)};
+                auto& block{emplaceBlock(address + 1)->second};
+                it = std::next(blocks->begin(), position);
+                block.assign(it->second.cbegin() + offset, it->second.cend());
+            }
 
-                // Exit the loop
-                break;
+            // Truncate or delete existing block
+            const auto size{address - it->first};
+            if (size > 0)
+            {
+                it->second.resize(size);
+            }
+            else
+            {
+                blocks->erase(it);
+                resetBlockCursor();
             }
             break;
         }
@@ -1144,6 +1677,9 @@ void HexSection::clearData(HexDataAddressType address)
 
 HexDataSizeType HexSection::clearData(HexDataAddressType address, HexDataSizeType size)
 {
+    touch();
+    unshareData();
+
     switch (getSectionType())
     {
         case HexSectionType::SECTION_DATA:
@@ -1154,6 +1690,12 @@ HexDataSizeType HexSection::clearData(HexDataAddressType address, HexDataSizeTyp
             if (!HexAddress::isValidRelativeAddressRange(address, size))
                 throw std::out_of_range("Relative address range is out of range");
 
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
+            {
+                page->clearData(address, size);
+                return size;
+            }
+
             // Define current address and result
             HexDataAddressType currentAddress{address};
             HexDataSizeType result{0};
@@ -1161,19 +1703,10 @@ HexDataSizeType HexSection::clearData(HexDataAddressType address, HexDataSizeTyp
             // Clear data
             while (result < size)
             {
-                // Find block
-                auto it{blocks.begin()};
-                while (it != blocks.end())
-                {
-                    // Find block which either contains address or is before it
-                    if ((it->first + it->second.size()) > currentAddress)
-                        break;
+                // Find block which either contains address or is after it
+                auto it{findNextBlock(currentAddress)};
 
-                    // Increment block
-                    ++it;
-                }
-
-                if (it == blocks.end())
+                if (it == blocks->end())
                 {
                     // Nothing to clear since there are no more data blocks
                     // after the current address
@@ -1218,8 +1751,10 @@ HexDataSizeType HexSection::clearData(HexDataAddressType address, HexDataSizeTyp
                     // Is there a need to create new block after the cleared part?
                     if (sizeNew > 0)
                     {
-                        // Create new block
-                        auto& block{blocks[it->first + static_cast<HexDataAddressType>(offsetNew)]};
+                        // Create new block after the current one
+                        const auto position{std::distance(blocks->begin(), it)};
+                        auto& block{emplaceBlock(it->first + static_cast<HexDataAddressType>(offsetNew))->second};
+                        it = std::next(blocks->begin(), position);
                         block.reserve(sizeNew);
 
                         // Copy data
@@ -1235,7 +1770,8 @@ HexDataSizeType HexSection::clearData(HexDataAddressType address, HexDataSizeTyp
                     if (it->second.size() == clearSize)
                     {
                         // Clear whole block
-                        blocks.erase(it->first);
+                        blocks->erase(it);
+                        resetBlockCursor();
                     }
                     else
                     {
@@ -1275,18 +1811,16 @@ HexDataType HexSection::getData(HexDataAddressType address) const
         case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
         case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
         {
-            for (auto it{blocks.crbegin()}; it != blocks.crend(); ++it)
-            {
-                if (it->first <= address)
-                {
-                    // The condition above guarantees the difference will always be positive
-                    const auto index{static_cast<size_t>(address - it->first)};
-                    if (index < it->second.size())
-                        return it->second[index];
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
+                return (page->hasData(address) ? page->getData()[address] : unusedDataFillValue);
 
-                    // Address is below the address of the block
-                    break;
-                }
+            const auto it{findBlock(address)};
+            if (it != blocks->end())
+            {
+                // Block starts at or before the address so the difference will always be positive
+                const auto index{static_cast<size_t>(address - it->first)};
+                if (index < it->second.size())
+                    return it->second[index];
             }
 
             // Return unused data fill value
@@ -1315,25 +1849,22 @@ HexDataSizeType HexSection::getData(HexDataAddressType address, HexDataType* dat
             if (!HexAddress::isValidRelativeAddressRange(address, dataSize))
                 throw std::out_of_range("Relative address range is out of range");
 
-            // Find block
-            auto it{blocks.cbegin()};
-            while (it != blocks.cend())
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
             {
-                // Find block which either contains address or is before it
-                if ((it->first + it->second.size()) > address)
-                    break;
-
-                // Increment block
-                ++it;
+                page->getData(address, data, dataSize, unusedDataFillValue);
+                return dataSize;
             }
 
+            // Find block which either contains address or is after it
+            auto it{findNextBlock(address)};
+
             // Result is data size
             HexDataSizeType result{0};
 
             // Copy data or use unused data fill value
             while (result < dataSize)
             {
-                if (it == blocks.cend())
+                if (it == blocks->cend())
                 {
                     // Use unused data fill value if there is no block at or after the address
                     for (; result < dataSize; ++result)
@@ -1413,25 +1944,25 @@ HexDataSizeType HexSection::getData(HexDataAddressType address, HexDataVector& d
             if (data.size() < offset)
                 throw std::underflow_error("Size of the data vector is smaller than the offset");
 
-            // Find block
-            auto it{blocks.cbegin()};
-            while (it != blocks.cend())
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
             {
-                // Find block which either contains address or is before it
-                if ((it->first + it->second.size()) > address)
-                    break;
+                if (data.size() < (offset + dataSize))
+                    data.resize(offset + dataSize);
 
-                // Increment block
-                ++it;
+                page->getData(address, data.data() + offset, dataSize, unusedDataFillValue);
+                return dataSize;
             }
 
+            // Find block which either contains address or is after it
+            auto it{findNextBlock(address)};
+
             // Result is data size
             HexDataSizeType result{0};
 
             // Copy data or use unused data fill value
             while (result < dataSize)
             {
-                if (it == blocks.cend())
+                if (it == blocks->cend())
                 {
                     // Use unused data fill value if there is no block at or after the address
                     for (; result < dataSize; ++result)
@@ -1516,44 +2047,43 @@ HexDataSizeType HexSection::getData(HexDataAddressType address, HexDataVector& d
 
 void HexSection::setData(HexDataAddressType address, HexDataType data)
 {
+    touch();
+    unshareData();
+
     switch (getSectionType())
     {
         case HexSectionType::SECTION_DATA:
         case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
         case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
         {
-            for (auto it{blocks.rbegin()}; it != blocks.rend(); ++it)
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
             {
-                if (it->first <= address)
-                {
-                    // The condition above guarantees the difference will always be positive
-                    const auto index{static_cast<size_t>(address - it->first)};
-                    if (index < it->second.size())
-                    {
-                        // Use this block if it contains address
-                        it->second[index] = data;
-                        return;
-                    }
-                    else if (index == it->second.size())
-                    {
-                        // If block size is of default size then
-                        // make a new block instead
-                        if ((it->second.size() % defaultDataSize) == 0)
-                            break;
-
-                        // Append to the existing block if an address
-                        // naturally follows it
-                        it->second.push_back(data);
-                        return;
-                    }
+                page->setData(address, &data, 1);
+                return;
+            }
 
-                    // Address is below the address of the block
-                    break;
+            const auto it{findBlock(address)};
+            if (it != blocks->end())
+            {
+                // Block starts at or before the address so the difference will always be positive
+                const auto index{static_cast<size_t>(address - it->first)};
+                if (index < it->second.size())
+                {
+                    // Use this block if it contains address
+                    it->second[index] = data;
+                    return;
+                }
+                else if ((index == it->second.size()) && ((it->second.size() % defaultDataSize) != 0))
+                {
+                    // Append to the existing block if an address naturally
+                    // follows it, unless the block is of default size
+                    it->second.push_back(data);
+                    return;
                 }
             }
 
             // Create new block
-            blocks[address].push_back(data);
+            emplaceBlock(address)->second.push_back(data);
             break;
         }
 
@@ -1568,6 +2098,9 @@ void HexSection::setData(HexDataAddressType address, HexDataType data)
 
 HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataType* data, HexDataSizeType dataSize)
 {
+    touch();
+    unshareData();
+
     switch (getSectionType())
     {
         case HexSectionType::SECTION_DATA:
@@ -1578,23 +2111,20 @@ HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataTyp
             if (!HexAddress::isValidRelativeAddressRange(address, dataSize))
                 throw std::out_of_range("Relative address range is out of range");
 
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
+            {
+                page->setData(address, data, dataSize);
+                return dataSize;
+            }
+
             // Result is data size
             HexDataSizeType result{0};
             while (result < dataSize)
             {
-                // Find block
-                auto it{blocks.begin()};
-                while (it != blocks.end())
-                {
-                    // Find block which either contains address or is before it
-                    if ((it->first + it->second.size()) > address)
-                        break;
+                // Find block which either contains address or is after it
+                auto it{findNextBlock(address)};
 
-                    // Increment block
-                    ++it;
-                }
-
-                if (it == blocks.end())
+                if (it == blocks->end())
                 {
                     // Create block if there is no block at or after the address
 
@@ -1602,7 +2132,7 @@ HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataTyp
                     const HexDataSizeType size{std::min((dataSize - result), defaultDataSize)};
 
                     // Create new block
-                    auto& block{blocks[address]};
+                    auto& block{emplaceBlock(address)->second};
                     block.reserve(size);
 
                     // Append data
@@ -1631,7 +2161,7 @@ HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataTyp
                     size = std::min(size, defaultDataSize);
 
                     // Create new block
-                    auto& block{blocks[address]};
+                    auto& block{emplaceBlock(address)->second};
                     block.reserve(size);
 
                     // Append data
@@ -1663,7 +2193,7 @@ HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataTyp
 
                     // Limit amount of data that could be appended
                     // to the current block to reach the next block
-                    if (next != blocks.end())
+                    if (next != blocks->end())
                     {
                         // Difference of addresses between the current and next block
                         // considering the offset
@@ -1707,6 +2237,9 @@ HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataTyp
 
 HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataVector& data, HexDataSizeType dataSize, HexDataSizeType offset)
 {
+    touch();
+    unshareData();
+
     switch (getSectionType())
     {
         case HexSectionType::SECTION_DATA:
@@ -1725,23 +2258,20 @@ HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataVec
             if ((offset + dataSize) > data.size())
                 dataSize = (data.size() - offset);
 
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
+            {
+                page->setData(address, data.data() + offset, dataSize);
+                return dataSize;
+            }
+
             // Result is data size
             HexDataSizeType result{0};
             while (result < dataSize)
             {
-                // Find block
-                auto it{blocks.begin()};
-                while (it != blocks.end())
-                {
-                    // Find block which either contains address or is before it
-                    if ((it->first + it->second.size()) > address)
-                        break;
-
-                    // Increment block
-                    ++it;
-                }
+                // Find block which either contains address or is after it
+                auto it{findNextBlock(address)};
 
-                if (it == blocks.end())
+                if (it == blocks->end())
                 {
                     // Create block if there is no block at or after the address
 
@@ -1749,7 +2279,7 @@ HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataVec
                     const HexDataSizeType size{std::min((dataSize - result), defaultDataSize)};
 
                     // Create new block
-                    auto& block{blocks[address]};
+                    auto& block{emplaceBlock(address)->second};
                     block.reserve(size);
 
                     // Append data
@@ -1778,7 +2308,7 @@ HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataVec
                     size = std::min(size, defaultDataSize);
 
                     // Create new block
-                    auto& block{blocks[address]};
+                    auto& block{emplaceBlock(address)->second};
                     block.reserve(size);
 
                     // Append data
@@ -1810,7 +2340,7 @@ HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataVec
 
                     // Limit amount of data that could be appended
                     // to the current block to reach the next block
-                    if (next != blocks.end())
+                    if (next != blocks->end())
                     {
                         // Difference of addresses between the current and next block
                         // considering the offset
@@ -1854,6 +2384,9 @@ HexDataSizeType HexSection::setData(HexDataAddressType address, const HexDataVec
 
 HexDataSizeType HexSection::fillData(HexDataAddressType address, HexDataSizeType dataSize, HexDataType data)
 {
+    touch();
+    unshareData();
+
     switch (getSectionType())
     {
         case HexSectionType::SECTION_DATA:
@@ -1864,23 +2397,20 @@ HexDataSizeType HexSection::fillData(HexDataAddressType address, HexDataSizeType
             if (!HexAddress::isValidRelativeAddressRange(address, dataSize))
                 throw std::out_of_range("Relative address range is out of range");
 
+            if (storageType == HexSectionStorageType::STORAGE_PAGE)
+            {
+                page->fillData(address, dataSize, data);
+                return dataSize;
+            }
+
             // Result is data size
             HexDataSizeType result{0};
             while (result < dataSize)
             {
-                // Find block
-                auto it{blocks.begin()};
-                while (it != blocks.end())
-                {
-                    // Find block which either contains address or is before it
-                    if ((it->first + it->second.size()) > address)
-                        break;
-
-                    // Increment block
-                    ++it;
-                }
+                // Find block which either contains address or is after it
+                auto it{findNextBlock(address)};
 
-                if (it == blocks.end())
+                if (it == blocks->end())
                 {
                     // Create block if there is no block at or after the address
 
@@ -1888,7 +2418,7 @@ HexDataSizeType HexSection::fillData(HexDataAddressType address, HexDataSizeType
                     const HexDataSizeType size{std::min((dataSize - result), defaultDataSize)};
 
                     // Create new block
-                    auto& block{blocks[address]};
+                    auto& block{emplaceBlock(address)->second};
                     block.reserve(size);
 
                     // Append data
@@ -1917,7 +2447,7 @@ HexDataSizeType HexSection::fillData(HexDataAddressType address, HexDataSizeType
                     size = std::min(size, defaultDataSize);
 
                     // Create new block
-                    auto& block{blocks[address]};
+                    auto& block{emplaceBlock(address)->second};
                     block.reserve(size);
 
                     // Append data
@@ -1949,7 +2479,7 @@ HexDataSizeType HexSection::fillData(HexDataAddressType address, HexDataSizeType
 
                     // Limit amount of data that could be appended
                     // to the current block to reach the next block
-                    if (next != blocks.end())
+                    if (next != blocks->end())
                     {
                         // Difference of addresses between the current and next block
                         // considering the offset
@@ -1993,15 +2523,23 @@ HexDataSizeType HexSection::fillData(HexDataAddressType address, HexDataSizeType
 
 void HexSection::compact()
 {
+    touch();
+
+    // Records of the page storage are always compact
+    if (storageType == HexSectionStorageType::STORAGE_PAGE)
+        return;
+
+    unshareData();
+
     // Iterate through blocks
-    auto it{blocks.begin()};
-    while (it != blocks.end())
+    auto it{blocks->begin()};
+    while (it != blocks->end())
     {
         // Next block
         auto next{std::next(it)};
 
         // Does the next block exist?
-        if (next == blocks.end())
+        if (next == blocks->end())
             break;
 
         // Is next block adjacent to the current one?
@@ -2022,36 +2560,281 @@ void HexSection::compact()
         // The condition above guarantees the difference will always be positive
         const HexDataSizeType size{std::min((defaultDataSize - it->second.size()), next->second.size())};
 
-        // Size of the data to move to the new block
+        // Size of the data remaining in the next block
         // The condition above guarantees the difference will always be positive
         const HexDataSizeType sizeNew{next->second.size() - size};
 
-        // Create new block
+        // Append to the current block from the next block
+        for (HexDataSizeType index{0}; index < size; ++index)
+            it->second.push_back(next->second.at(index));
+
         if (sizeNew > 0)
         {
-            // Address of the new block
-            const auto address{static_cast<HexDataAddressType>(next->first + size)};
+            // Remaining data of the next block starts after the moved data
+            next->first = static_cast<HexDataAddressType>(next->first + size);
+            next->second.erase(next->second.begin(), next->second.begin() + static_cast<std::ptrdiff_t>(size));
+        }
+        else
+        {
+            // Erase next block
+            blocks->erase(next);
+            resetBlockCursor();
+        }
+    }
+}
 
-            // Create new block
-            auto& block{blocks[address]};
-            block.reserve(sizeNew);
+HexRecordIterator::HexRecordIterator() :
+    section{nullptr},
+    sectionRecord{false},
+    block{},
+    blockOffset{0},
+    nextBlock{},
+    nextBlockOffset{0},
+    pageAddress{HEX_PAGE_SIZE},
+    pageRunEnd{0},
+    recordDataSize{0},
+    recordAlignment{0},
+    data{},
+    gathered{false},
+    record{}
+{
+}
+
+HexRecordIterator::HexRecordIterator(const HexSection& section, bool end, HexDataSizeType recordDataSize, HexDataSizeType recordAlignment) :
+    section{&section},
+    sectionRecord{false},
+    block{section.blocks->cend()},
+    blockOffset{0},
+    nextBlock{section.blocks->cend()},
+    nextBlockOffset{0},
+    pageAddress{HEX_PAGE_SIZE},
+    pageRunEnd{0},
+    recordDataSize{recordDataSize},
+    recordAlignment{recordAlignment},
+    data{},
+    gathered{false},
+    record{}
+{
+    if (recordDataSize > MAXIMUM_HEX_RECORD_DATA_SIZE)
+        throw std::out_of_range("Record data size is out of range");
+
+    if (end)
+        return;
+
+    switch (section.getSectionType())
+    {
+        // Data blocks only
+        case HexSectionType::SECTION_DATA:
+            block = section.blocks->cbegin();
+            if (section.storageType == HexSectionStorageType::STORAGE_PAGE)
+                pageAddress = 0;
+            break;
 
-            // Populate new block
-            for (HexDataSizeType index{0}; index < sizeNew; ++index)
-                block.push_back(next->second.at(size + index));
+        // Section record followed by the data blocks
+        case HexSectionType::SECTION_EXTENDED_SEGMENT_ADDRESS:
+        case HexSectionType::SECTION_EXTENDED_LINEAR_ADDRESS:
+            sectionRecord = true;
+            block = section.blocks->cbegin();
+            if (section.storageType == HexSectionStorageType::STORAGE_PAGE)
+                pageAddress = 0;
+            break;
+
+        // Section record only
+        case HexSectionType::SECTION_END_OF_FILE:
+        case HexSectionType::SECTION_START_SEGMENT_ADDRESS:
+        case HexSectionType::SECTION_START_LINEAR_ADDRESS:
+        default:
+            sectionRecord = true;
+            break;
+    }
+
+    updateRecord();
+}
+
+HexRecordIterator::HexRecordIterator(const HexRecordIterator& iterator) :
+    section{iterator.section},
+    sectionRecord{iterator.sectionRecord},
+    block{iterator.block},
+    blockOffset{iterator.blockOffset},
+    nextBlock{iterator.nextBlock},
+    nextBlockOffset{iterator.nextBlockOffset},
+    pageAddress{iterator.pageAddress},
+    pageRunEnd{iterator.pageRunEnd},
+    recordDataSize{iterator.recordDataSize},
+    recordAlignment{iterator.recordAlignment},
+    data{iterator.data},
+    gathered{iterator.gathered},
+    record{iterator.record}
+{
+    // View of the gathered data refers to the own copy of the data
+    if (gathered)
+        record = HexRecordView{record.getAddress(), record.getRecordType(), data.data(), record.getDataSize(), record.getChecksum()};
+}
 
-            // Truncate existing block
-            for (HexDataSizeType index{0}; index < sizeNew; ++index)
-                next->second.pop_back();
+HexRecordIterator& HexRecordIterator::operator=(const HexRecordIterator& iterator)
+{
+    if (this != &iterator)
+    {
+        section = iterator.section;
+        sectionRecord = iterator.sectionRecord;
+        block = iterator.block;
+        blockOffset = iterator.blockOffset;
+        nextBlock = iterator.nextBlock;
+        nextBlockOffset = iterator.nextBlockOffset;
+        pageAddress = iterator.pageAddress;
+        pageRunEnd = iterator.pageRunEnd;
+        recordDataSize = iterator.recordDataSize;
+        recordAlignment = iterator.recordAlignment;
+        data = iterator.data;
+        gathered = iterator.gathered;
+        record = iterator.record;
+
+        // View of the gathered data refers to the own copy of the data
+        if (gathered)
+            record = HexRecordView{record.getAddress(), record.getRecordType(), data.data(), record.getDataSize(), record.getChecksum()};
+    }
+
+    return *this;
+}
+
+HexRecordIterator::reference HexRecordIterator::operator*() const
+{
+    return record;
+}
+
+HexRecordIterator::pointer HexRecordIterator::operator->() const
+{
+    return &record;
+}
+
+HexRecordIterator& HexRecordIterator::operator++()
+{
+    if (sectionRecord)
+    {
+        sectionRecord = false;
+    }
+    else if (pageAddress < HEX_PAGE_SIZE)
+    {
+        pageAddress += record.getDataSize();
+    }
+    else
+    {
+        block = nextBlock;
+        blockOffset = nextBlockOffset;
+    }
+
+    updateRecord();
+    return *this;
+}
+
+HexRecordIterator HexRecordIterator::operator++(int)
+{
+    HexRecordIterator result{*this};
+    ++(*this);
+    return result;
+}
+
+bool HexRecordIterator::operator==(const HexRecordIterator& other) const
+{
+    return ((section == other.section) && (sectionRecord == other.sectionRecord) && (block == other.block) && (blockOffset == other.blockOffset) && (pageAddress == other.pageAddress));
+}
+
+bool HexRecordIterator::operator!=(const HexRecordIterator& other) const
+{
+    return !(*this == other);
+}
+
+void HexRecordIterator::updateRecord()
+{
+    gathered = false;
+    if (sectionRecord)
+    {
+        // View of the section record
+        record = section->section.getView();
+        return;
+    }
+
+    if (pageAddress < HEX_PAGE_SIZE)
+    {
+        // Find the next contiguous data of the page
+        auto size{section->findPageRecord(pageAddress, pageRunEnd)};
+        if (size == 0)
+        {
+            pageAddress = HEX_PAGE_SIZE;
+            return;
         }
 
-        // Append to the current block from the next block
-        for (HexDataSizeType index{0}; index < size; ++index)
-            it->second.push_back(next->second.at(index));
+        // Limit the record by the data size and the alignment boundary
+        if (recordDataSize > 0)
+        {
+            size = std::min(recordDataSize, pageRunEnd - pageAddress);
+            if (recordAlignment > 1)
+                size = std::min(size, recordAlignment - (pageAddress % recordAlignment));
+        }
 
-        // Erase next block
-        blocks.erase(next);
+        // View of the data within the page
+        record = HexRecordView{static_cast<HexDataAddressType>(pageAddress), HexRecordType::RECORD_DATA, section->page->getData() + pageAddress, size};
+        return;
     }
+
+    if (block == section->blocks->cend())
+        return;
+
+    if (block->second.size() < 1)
+        throw std::out_of_range("Data size is out of range");
+
+    if (recordDataSize == 0)
+    {
+        // View of the data block
+        record = HexRecordView{block->first, HexRecordType::RECORD_DATA, block->second.data(), block->second.size()};
+        nextBlock = std::next(block);
+        nextBlockOffset = 0;
+        return;
+    }
+
+    // Limit the record by the data size and the alignment boundary
+    const auto address{static_cast<HexAddressType>(block->first) + static_cast<HexAddressType>(blockOffset)};
+    auto size{recordDataSize};
+    if (recordAlignment > 1)
+        size = std::min(size, recordAlignment - (address % recordAlignment));
+
+    if ((blockOffset + size) <= block->second.size())
+    {
+        // View of the data within the current block
+        record = HexRecordView{static_cast<HexDataAddressType>(address), HexRecordType::RECORD_DATA, block->second.data() + blockOffset, size};
+        nextBlock = block;
+        nextBlockOffset = blockOffset + size;
+        if (nextBlockOffset == block->second.size())
+        {
+            ++nextBlock;
+            nextBlockOffset = 0;
+        }
+        return;
+    }
+
+    // Gather the data of the record from the contiguous blocks
+    HexDataSizeType dataSize{0};
+    nextBlock = block;
+    nextBlockOffset = blockOffset;
+    while (dataSize < size)
+    {
+        const auto count{std::min(size - dataSize, nextBlock->second.size() - nextBlockOffset)};
+        std::copy_n(nextBlock->second.data() + nextBlockOffset, count, data.data() + dataSize);
+        dataSize += count;
+        nextBlockOffset += count;
+        if (nextBlockOffset < nextBlock->second.size())
+            break;
+
+        // Continue with the next block only if it follows the current one
+        const auto blockEnd{static_cast<HexAddressType>(nextBlock->first) + static_cast<HexAddressType>(nextBlock->second.size())};
+        ++nextBlock;
+        nextBlockOffset = 0;
+        if ((nextBlock == section->blocks->cend()) || (nextBlock->first != blockEnd) || (nextBlock->second.size() < 1))
+            break;
+    }
+
+    record = HexRecordView{static_cast<HexDataAddressType>(address), HexRecordType::RECORD_DATA, data.data(), dataSize};
+    gathered = true;
 }
 
 END_NAMESPACE_LIBIHEX
@@ -0,0 +1,282 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <ihex/hex_sink.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LIBIHEX_HEX_SINK_POSIX
+#include <cerrno>
+#include <sys/uio.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#define LIBIHEX_HEX_SINK_WIN32
+#include <io.h>
+#endif
+
+BEGIN_NAMESPACE_LIBIHEX
+
+#ifdef LIBIHEX_HEX_SINK_DESCRIPTOR
+namespace
+{
+    /**
+     * @brief Write data to a file descriptor
+     *
+     * @param descriptor File descriptor
+     * @param data Pointer to the data
+     * @param dataSize Size of the data
+     * @return true Successfully written all of the data
+     * @return false Write failed
+     */
+    bool writeDescriptor(int descriptor, const char* data, size_t dataSize)
+    {
+        while (dataSize > 0)
+        {
+#ifdef LIBIHEX_HEX_SINK_POSIX
+            auto written{::write(descriptor, data, dataSize)};
+            if ((written < 0) && (errno == EINTR))
+                continue;
+#elif defined(LIBIHEX_HEX_SINK_WIN32)
+            auto written{::_write(descriptor, data, static_cast<unsigned int>(std::min<size_t>(dataSize, 0x40000000)))};
+#endif
+            if (written <= 0)
+                return false;
+
+            // Continue after a partial write
+            data += written;
+            dataSize -= static_cast<size_t>(written);
+        }
+
+        return true;
+    }
+}
+#endif
+
+HexSink::HexSink(size_t bufferSize) :
+    buffer(bufferSize), pendingSize{0}
+{
+
+}
+
+HexSink::~HexSink()
+{
+
+}
+
+bool HexSink::write(const char* data, size_t dataSize)
+{
+    // Data fits into the buffer
+    if ((pendingSize + dataSize) <= buffer.size())
+    {
+        std::memcpy(buffer.data() + pendingSize, data, dataSize);
+        pendingSize += dataSize;
+        return true;
+    }
+
+    // Data fits into the buffer after flushing it
+    if (dataSize < buffer.size())
+    {
+        if (!flush())
+            return false;
+
+        std::memcpy(buffer.data(), data, dataSize);
+        pendingSize = dataSize;
+        return true;
+    }
+
+    // Data larger than the buffer bypasses it
+    auto result{output(buffer.data(), pendingSize, data, dataSize)};
+    pendingSize = 0;
+    return result;
+}
+
+char* HexSink::prepare(size_t dataSize)
+{
+    if ((pendingSize + dataSize) > buffer.size())
+    {
+        if (!flush())
+            return nullptr;
+
+        if (dataSize > buffer.size())
+            buffer.resize(dataSize);
+    }
+
+    return (buffer.data() + pendingSize);
+}
+
+void HexSink::commit(size_t dataSize)
+{
+    pendingSize += dataSize;
+}
+
+bool HexSink::flush()
+{
+    if (pendingSize == 0)
+        return true;
+
+    auto result{output(buffer.data(), pendingSize)};
+    pendingSize = 0;
+    return result;
+}
+
+size_t HexSink::getBufferSize() const
+{
+    return buffer.size();
+}
+
+size_t HexSink::getPendingSize() const
+{
+    return pendingSize;
+}
+
+bool HexSink::output(const char* first, size_t firstSize, const char* second, size_t secondSize)
+{
+    return (((firstSize == 0) || output(first, firstSize)) && ((secondSize == 0) || output(second, secondSize)));
+}
+
+#ifdef LIBIHEX_HEX_SINK_DESCRIPTOR
+HexFileDescriptorSink::HexFileDescriptorSink(int descriptor, size_t bufferSize) :
+    HexSink{bufferSize}, descriptor{descriptor}
+{
+
+}
+
+HexFileDescriptorSink::~HexFileDescriptorSink()
+{
+    flush();
+}
+
+int HexFileDescriptorSink::getDescriptor() const
+{
+    return descriptor;
+}
+
+bool HexFileDescriptorSink::output(const char* data, size_t dataSize)
+{
+    return writeDescriptor(descriptor, data, dataSize);
+}
+
+bool HexFileDescriptorSink::output(const char* first, size_t firstSize, const char* second, size_t secondSize)
+{
+#ifdef LIBIHEX_HEX_SINK_POSIX
+    if ((firstSize == 0) || (secondSize == 0))
+        return HexSink::output(first, firstSize, second, secondSize);
+
+    // Write both blocks with a single system call
+    struct iovec vectors[2]{{const_cast<char*>(first), firstSize}, {const_cast<char*>(second), secondSize}};
+    auto written{::writev(descriptor, vectors, 2)};
+    while ((written < 0) && (errno == EINTR))
+        written = ::writev(descriptor, vectors, 2);
+
+    if (written < 0)
+        return false;
+
+    // Continue after a partial write
+    auto size{static_cast<size_t>(written)};
+    if (size < firstSize)
+        return (writeDescriptor(descriptor, first + size, firstSize - size) && writeDescriptor(descriptor, second, secondSize));
+
+    size -= firstSize;
+    return writeDescriptor(descriptor, second + size, secondSize - size);
+#else
+    return HexSink::output(first, firstSize, second, secondSize);
+#endif
+}
+#endif
+
+HexMemorySink::HexMemorySink(size_t reserveSize) :
+    HexSink{0}, data{}, preparedSize{0}
+{
+    data.reserve(reserveSize);
+}
+
+HexMemorySink::~HexMemorySink()
+{
+
+}
+
+bool HexMemorySink::write(const char* data, size_t dataSize)
+{
+    return output(data, dataSize);
+}
+
+char* HexMemorySink::prepare(size_t dataSize)
+{
+    // Drop the space prepared before, which was not committed
+    data.resize(data.size() - preparedSize + dataSize);
+    preparedSize = dataSize;
+    return (data.data() + data.size() - dataSize);
+}
+
+void HexMemorySink::commit(size_t dataSize)
+{
+    data.resize(data.size() - preparedSize + std::min(dataSize, preparedSize));
+    preparedSize = 0;
+}
+
+bool HexMemorySink::flush()
+{
+    return true;
+}
+
+const std::string& HexMemorySink::getData() const
+{
+    return data;
+}
+
+std::string HexMemorySink::releaseData()
+{
+    std::string result{std::move(data)};
+    clear();
+    return result;
+}
+
+void HexMemorySink::clear()
+{
+    data.clear();
+    preparedSize = 0;
+}
+
+bool HexMemorySink::output(const char* data, size_t dataSize)
+{
+    this->data.append(data, dataSize);
+    return true;
+}
+
+HexStreamSink::HexStreamSink(std::ostream& stream, size_t bufferSize) :
+    HexSink{bufferSize}, stream{stream}
+{
+
+}
+
+HexStreamSink::~HexStreamSink()
+{
+    flush();
+}
+
+bool HexStreamSink::output(const char* data, size_t dataSize)
+{
+    stream.write(data, static_cast<std::streamsize>(dataSize));
+    return bool(stream);
+}
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,340 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <ihex/hex_codec.hpp>
+#include <ihex/hex_visitor.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+namespace
+{
+    /**
+     * @brief Size of the stream read buffer
+     *
+     */
+    constexpr size_t VISIT_STREAM_BUFFER_SIZE{0x10000};
+
+    /**
+     * @brief Maximum number of bytes in a record (size, address, type, data and checksum)
+     *
+     */
+    constexpr size_t MAXIMUM_RECORD_BYTES{1 + 2 + 1 + MAXIMUM_HEX_RECORD_DATA_SIZE + 1};
+
+    /**
+     * @brief Maximum size of the line carried over between stream reads
+     *
+     * @note Characters past the checksum are ignored, so longer lines are truncated
+     */
+    constexpr size_t MAXIMUM_PENDING_LINE_SIZE{1 + (2 * MAXIMUM_RECORD_BYTES)};
+
+    /**
+     * @brief Size of the relative address space
+     *
+     */
+    constexpr HexAddressType RELATIVE_ADDRESS_SPACE_SIZE{0x10000};
+
+    /**
+     * @brief Size of the ADDRESS_I16HEX address space
+     *
+     */
+    constexpr HexAddressType SEGMENT_ADDRESS_SPACE_SIZE{0x100000};
+}
+
+HexVisitor::HexVisitor() :
+    addressType{HexAddressEnumType::ADDRESS_I8HEX}, extendedAddress{0}, lineNumber{0}, lineOffset{0}, nextLineOffset{0}
+{
+
+}
+
+bool HexVisitor::visit(const std::string& fileName)
+{
+    // Open file
+    std::ifstream stream{fileName.c_str(), std::ios_base::in | std::ios_base::binary};
+    if (!stream.is_open())
+        return false;
+
+    // Visit file
+    return visit(stream);
+}
+
+bool HexVisitor::visit(std::istream& stream)
+{
+    bool result{true};
+    std::vector<char> buffer(VISIT_STREAM_BUFFER_SIZE);
+    std::string pending{};
+    size_t pendingSize{0};
+
+    while (stream)
+    {
+        stream.read(buffer.data(), buffer.size());
+        const auto end{buffer.data() + stream.gcount()};
+
+        // Visit every complete line
+        auto position{static_cast<const char*>(buffer.data())};
+        while (position < end)
+        {
+            auto separator{static_cast<const char*>(std::memchr(position, HEX_RECORD_LINE_SEPARATOR, end - position))};
+            auto lineEnd{(separator == nullptr) ? end : separator};
+
+            // Carry the incomplete line over to the next read
+            auto size{std::min(static_cast<size_t>(lineEnd - position), MAXIMUM_PENDING_LINE_SIZE - std::min(pending.size(), MAXIMUM_PENDING_LINE_SIZE))};
+            if (separator == nullptr)
+            {
+                pending.append(position, size);
+                pendingSize += (lineEnd - position);
+                break;
+            }
+
+            bool proceed{true};
+            if (pendingSize == 0)
+            {
+                proceed = processLine(std::string_view{position, static_cast<size_t>(lineEnd - position)}, (lineEnd - position) + 1, result);
+            }
+            else
+            {
+                pending.append(position, size);
+                proceed = processLine(pending, pendingSize + (lineEnd - position) + 1, result);
+                pending.clear();
+                pendingSize = 0;
+            }
+
+            if (!proceed)
+                return false;
+
+            position = separator + 1;
+        }
+    }
+
+    // Visit the last line without line separator
+    if (pendingSize > 0)
+        processLine(pending, pendingSize, result);
+
+    return result;
+}
+
+bool HexVisitor::visit(const char* data, size_t dataSize)
+{
+    bool result{true};
+    size_t position{0};
+    while (position < dataSize)
+    {
+        auto separator{static_cast<const char*>(std::memchr(data + position, HEX_RECORD_LINE_SEPARATOR, dataSize - position))};
+        auto lineEnd{(separator == nullptr) ? dataSize : static_cast<size_t>(separator - data)};
+
+        if (!processLine(std::string_view{data + position, lineEnd - position}, std::min(lineEnd + 1, dataSize) - position, result))
+            return false;
+
+        position = lineEnd + 1;
+    }
+
+    return result;
+}
+
+bool HexVisitor::visitLine(std::string_view line)
+{
+    bool result{true};
+    processLine(line, line.size() + 1, result);
+    return result;
+}
+
+void HexVisitor::reset()
+{
+    resetAddress();
+    lineNumber = 0;
+    lineOffset = 0;
+    nextLineOffset = 0;
+}
+
+HexAddressEnumType HexVisitor::getAddressType() const
+{
+    return addressType;
+}
+
+uint16_t HexVisitor::getExtendedAddress() const
+{
+    return extendedAddress;
+}
+
+size_t HexVisitor::getLineNumber() const
+{
+    return lineNumber;
+}
+
+size_t HexVisitor::getLineOffset() const
+{
+    return lineOffset;
+}
+
+void HexVisitor::onData(HexAddressType, const HexDataType*, HexDataSizeType)
+{
+
+}
+
+void HexVisitor::onEndOfFile()
+{
+
+}
+
+void HexVisitor::onExtendedSegmentAddress(uint16_t)
+{
+
+}
+
+void HexVisitor::onStartSegmentAddress(uint16_t, uint16_t)
+{
+
+}
+
+void HexVisitor::onExtendedLinearAddress(uint16_t)
+{
+
+}
+
+void HexVisitor::onStartLinearAddress(uint32_t)
+{
+
+}
+
+bool HexVisitor::onInvalidRecord(std::string_view)
+{
+    return true;
+}
+
+bool HexVisitor::onChecksumMismatch(std::string_view)
+{
+    return true;
+}
+
+bool HexVisitor::processLine(std::string_view line, size_t lineSize, bool& result)
+{
+    // Advance the line position
+    ++lineNumber;
+    lineOffset = nextLineOffset;
+    nextLineOffset += lineSize;
+
+    // Ignore empty lines
+    if (line.size() == 0)
+        return true;
+
+    // Parse size of data and check length (start character, size, address, type, data and checksum)
+    HexDataType bytes[MAXIMUM_RECORD_BYTES];
+    if ((line.size() < 3) || !HexCodec::decodeByte(line.data() + 1, bytes[0]) ||
+        (line.size() < (11U + (2 * static_cast<HexDataSizeType>(bytes[0])))))
+    {
+        result = false;
+        return onInvalidRecord(line);
+    }
+
+    // Parse address, record type, data and checksum at once
+    const HexDataSizeType dataSize{bytes[0]};
+    const HexDataSizeType byteCount{dataSize + 5};
+    if (!HexCodec::decode(line.data() + 3, bytes + 1, byteCount - 1))
+    {
+        result = false;
+        return onInvalidRecord(line);
+    }
+
+    // Unsupported record types are handled as RECORD_MAX (same as HexRecord::setRecord)
+    const HexDataAddressType address{static_cast<HexDataAddressType>((bytes[1] << 8) | bytes[2])};
+    const auto recordType{std::min(static_cast<HexRecordType>(bytes[3]), HexRecordType::RECORD_MAX)};
+    if (!HexRecord::isValidRecord(recordType, dataSize, address))
+    {
+        result = false;
+        return onInvalidRecord(line);
+    }
+
+    // Verify checksum (sum of all bytes is 0)
+    HexDataType checksum{0};
+    for (HexDataSizeType index{0}; index < byteCount; ++index)
+        checksum += bytes[index];
+
+    if (checksum != 0)
+    {
+        result = false;
+        return onChecksumMismatch(line);
+    }
+
+    // Report the record
+    const HexDataType* data{bytes + 4};
+    switch (recordType)
+    {
+        case HexRecordType::RECORD_DATA:
+        {
+            // Split data at the relative and ADDRESS_I16HEX address space wraparounds
+            HexDataAddressType relativeAddress{address};
+            HexDataSizeType offset{0};
+            while (offset < dataSize)
+            {
+                auto absoluteAddress{HexAddress::getAbsoluteAddress(addressType, relativeAddress, extendedAddress)};
+                auto size{std::min(dataSize - offset, static_cast<HexDataSizeType>(RELATIVE_ADDRESS_SPACE_SIZE - relativeAddress))};
+                if (addressType == HexAddressEnumType::ADDRESS_I16HEX)
+                    size = std::min(size, static_cast<HexDataSizeType>(SEGMENT_ADDRESS_SPACE_SIZE - absoluteAddress));
+
+                onData(absoluteAddress, data + offset, size);
+                relativeAddress = static_cast<HexDataAddressType>(relativeAddress + size);
+                offset += size;
+            }
+            break;
+        }
+
+        case HexRecordType::RECORD_END_OF_FILE:
+            resetAddress();
+            onEndOfFile();
+            break;
+
+        case HexRecordType::RECORD_EXTENDED_SEGMENT_ADDRESS:
+            addressType = HexAddressEnumType::ADDRESS_I16HEX;
+            extendedAddress = static_cast<uint16_t>((data[0] << 8) | data[1]);
+            onExtendedSegmentAddress(extendedAddress);
+            break;
+
+        case HexRecordType::RECORD_START_SEGMENT_ADDRESS:
+            resetAddress();
+            onStartSegmentAddress(static_cast<uint16_t>((data[0] << 8) | data[1]), static_cast<uint16_t>((data[2] << 8) | data[3]));
+            break;
+
+        case HexRecordType::RECORD_EXTENDED_LINEAR_ADDRESS:
+            addressType = HexAddressEnumType::ADDRESS_I32HEX;
+            extendedAddress = static_cast<uint16_t>((data[0] << 8) | data[1]);
+            onExtendedLinearAddress(extendedAddress);
+            break;
+
+        case HexRecordType::RECORD_START_LINEAR_ADDRESS:
+        default:
+            resetAddress();
+            onStartLinearAddress((static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) | (static_cast<uint32_t>(data[2]) << 8) | data[3]);
+            break;
+    }
+
+    return true;
+}
+
+void HexVisitor::resetAddress()
+{
+    addressType = HexAddressEnumType::ADDRESS_I8HEX;
+    extendedAddress = 0;
+}
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,270 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <ihex/hex_writer.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+HexWriter::HexWriter(HexSink& sink, HexAddressEnumType addressType, HexDataSizeType recordDataSize, HexAddressType windowSize) :
+    sink{sink}, addressType{addressType}, recordDataSize{recordDataSize}, lineSeparator(1, HEX_RECORD_LINE_SEPARATOR),
+    window{}, windowUsed{}, windowAddress{0}, windowValid{false}, extendedAddress{0},
+    startAddress{HexRecordType::RECORD_END_OF_FILE}, finished{false}
+{
+    // Check the parameters
+    if ((addressType < HexAddressEnumType::ADDRESS_MIN) || (addressType > HexAddressEnumType::ADDRESS_MAX))
+        throw std::invalid_argument("Address type is not valid");
+
+    if ((recordDataSize == 0) || (recordDataSize > MAXIMUM_HEX_RECORD_DATA_SIZE))
+        throw std::out_of_range("Record data size is out of range");
+
+    if (windowSize == 0)
+        throw std::out_of_range("Window size is out of range");
+
+    // Allocate the window
+    window.resize(windowSize);
+    windowUsed.resize(windowSize);
+}
+
+HexWriter::~HexWriter()
+{
+
+}
+
+bool HexWriter::write(HexAddressType address, const HexDataType* data, HexDataSizeType dataSize)
+{
+    // Check the writer state and the address range
+    if (finished)
+        throw std::logic_error("Writer was already finished");
+
+    if (dataSize == 0)
+        return true;
+
+    if (!HexAddress::isValidAbsoluteAddressRange(addressType, address, dataSize))
+        throw std::out_of_range("Address range is out of range for the address type");
+
+    if (windowValid && (address < windowAddress))
+        throw std::out_of_range("Address is below the writer window");
+
+    // Position the window at the first write
+    auto windowSize{static_cast<HexDataSizeType>(window.size())};
+    if (!windowValid)
+    {
+        windowAddress = address - (address % windowSize);
+        windowValid = true;
+    }
+
+    // Write the data in pieces fitting the window
+    while (dataSize > 0)
+    {
+        auto size{std::min(dataSize, windowSize)};
+        auto end{static_cast<uint64_t>(address) + size};
+
+        // Slide the window forward (by at least half of its size) to make room for the data
+        if (end > (windowAddress + windowSize))
+        {
+            auto start{std::max<uint64_t>(end - windowSize, windowAddress + (windowSize / 2))};
+            if (!emitWindow(static_cast<HexDataSizeType>(std::min<uint64_t>(start, address) - windowAddress)))
+                return false;
+        }
+
+        // Copy the data to the window
+        auto offset{static_cast<HexDataSizeType>(address - windowAddress)};
+        std::copy(data, data + size, window.begin() + offset);
+        std::fill(windowUsed.begin() + offset, windowUsed.begin() + offset + size, true);
+
+        address += static_cast<HexAddressType>(size);
+        data += size;
+        dataSize -= size;
+    }
+
+    return true;
+}
+
+bool HexWriter::write(HexAddressType address, const HexDataVector& data)
+{
+    return write(address, data.data(), data.size());
+}
+
+void HexWriter::setStartSegmentAddress(uint16_t codeSegment, uint16_t instructionPointer)
+{
+    if (addressType != HexAddressEnumType::ADDRESS_I16HEX)
+        throw std::domain_error("Start segment address requires ADDRESS_I16HEX address type");
+
+    startAddress = HexRecord::makeStartSegmentAddressRecord(codeSegment, instructionPointer);
+}
+
+void HexWriter::setStartLinearAddress(uint32_t extendedInstructionPointer)
+{
+    if (addressType != HexAddressEnumType::ADDRESS_I32HEX)
+        throw std::domain_error("Start linear address requires ADDRESS_I32HEX address type");
+
+    startAddress = HexRecord::makeStartLinearAddressRecord(extendedInstructionPointer);
+}
+
+bool HexWriter::flush()
+{
+    // Emit the window up to the last written address
+    auto last{std::find(windowUsed.crbegin(), windowUsed.crend(), true)};
+    if (last != windowUsed.crend())
+    {
+        if (!emitWindow(static_cast<HexDataSizeType>(windowUsed.crend() - last)))
+            return false;
+    }
+
+    return sink.flush();
+}
+
+bool HexWriter::finish()
+{
+    if (finished)
+        throw std::logic_error("Writer was already finished");
+
+    finished = true;
+
+    // Emit the remaining data
+    if (!emitWindow(window.size()))
+        return false;
+
+    // Emit the start address and the end of file
+    if ((startAddress.getRecordType() != HexRecordType::RECORD_END_OF_FILE) && !emitRecord(startAddress.getView()))
+        return false;
+
+    if (!emitRecord(HexRecordView{}))
+        return false;
+
+    return sink.flush();
+}
+
+bool HexWriter::isFinished() const
+{
+    return finished;
+}
+
+HexAddressEnumType HexWriter::getAddressType() const
+{
+    return addressType;
+}
+
+HexDataSizeType HexWriter::getRecordDataSize() const
+{
+    return recordDataSize;
+}
+
+HexAddressType HexWriter::getWindowSize() const
+{
+    return static_cast<HexAddressType>(window.size());
+}
+
+std::string HexWriter::getLineSeparator() const
+{
+    return lineSeparator;
+}
+
+void HexWriter::setLineSeparator(const std::string& lineSeparator)
+{
+    if (lineSeparator.empty())
+        throw std::invalid_argument("Line separator must not be empty");
+
+    this->lineSeparator = lineSeparator;
+}
+
+bool HexWriter::emitWindow(HexDataSizeType count)
+{
+    // Segments of the upper address (records do not cross them)
+    static constexpr HexDataSizeType segmentSize{static_cast<HexDataSizeType>(std::numeric_limits<HexDataAddressType>::max()) + 1};
+
+    // Emit the runs of the written data
+    auto emitted{std::min(count, window.size())};
+    HexDataSizeType offset{0};
+    while (offset < emitted)
+    {
+        if (!windowUsed[offset])
+        {
+            offset++;
+            continue;
+        }
+
+        // Run is limited by the record data size and the segment end
+        auto start{offset};
+        auto address{windowAddress + start};
+        auto limit{std::min(emitted, start + std::min(recordDataSize, segmentSize - static_cast<HexDataSizeType>(address % segmentSize)))};
+        while ((offset < limit) && windowUsed[offset])
+            offset++;
+
+        if (!emitDataRecord(static_cast<HexAddressType>(address), window.data() + start, offset - start))
+            return false;
+    }
+
+    // Move the window past the emitted data
+    if (emitted < window.size())
+    {
+        std::copy(window.begin() + emitted, window.end(), window.begin());
+        std::copy(windowUsed.begin() + emitted, windowUsed.end(), windowUsed.begin());
+    }
+
+    std::fill(windowUsed.end() - emitted, windowUsed.end(), false);
+    windowAddress += count;
+    return true;
+}
+
+bool HexWriter::emitDataRecord(HexAddressType address, const HexDataType* data, HexDataSizeType dataSize)
+{
+    // Emit the extended address record when the upper part of the address changes
+    if (addressType != HexAddressEnumType::ADDRESS_I8HEX)
+    {
+        auto upper{(addressType == HexAddressEnumType::ADDRESS_I32HEX) ?
+            HexAddress::findExtendedLinearAddress(address) : HexAddress::findExtendedSegmentAddress(address)};
+
+        if (upper != extendedAddress)
+        {
+            auto record{(addressType == HexAddressEnumType::ADDRESS_I32HEX) ?
+                HexRecord::makeExtendedLinearAddressRecord(upper) : HexRecord::makeExtendedSegmentAddressRecord(upper)};
+
+            if (!emitRecord(record.getView()))
+                return false;
+
+            extendedAddress = upper;
+        }
+    }
+
+    // Emit the data record at the relative address
+    return emitRecord(HexRecordView{static_cast<HexDataAddressType>(address), HexRecordType::RECORD_DATA, data, dataSize});
+}
+
+bool HexWriter::emitRecord(const HexRecordView& record)
+{
+    // Encode the record directly to the sink buffer
+    auto length{record.getRecordLength()};
+    auto text{sink.prepare(length + lineSeparator.size())};
+    if (text == nullptr)
+        return false;
+
+    record.encode(text);
+    std::memcpy(text + length, lineSeparator.data(), lineSeparator.size());
+    sink.commit(length + lineSeparator.size());
+    return true;
+}
+
+END_NAMESPACE_LIBIHEX
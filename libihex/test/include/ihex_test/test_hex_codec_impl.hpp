@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <ihex/hex_codec.hpp>
+#include <ihex/version.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief HexCodecTest class
+ *
+ */
+class HexCodecTest : public testing::Test
+{
+    public:
+        /**
+         * @brief Construct a new HexCodecTest object
+         *
+         */
+        HexCodecTest();
+
+        /**
+         * @brief Destroy the HexCodecTest object
+         *
+         */
+        virtual ~HexCodecTest();
+
+    protected:
+        /**
+         * @brief Set up the test
+         *
+         */
+        virtual void SetUp() override;
+
+        /**
+         * @brief Tear down the test
+         *
+         */
+        virtual void TearDown() override;
+
+        /**
+         * @brief Perform tests on decodeNibble(), decodeByte() and decodeWord() functions
+         *
+         */
+        void performDecodeDigitTests();
+
+        /**
+         * @brief Perform tests on decode() function
+         *
+         */
+        void performDecodeTests();
+
+        /**
+         * @brief Perform tests on decode kernels
+         *
+         */
+        void performDecodeKernelTests();
+
+        /**
+         * @brief Perform tests on encodeByte(), encodeWord() and encode() functions
+         *
+         */
+        void performEncodeTests();
+
+        /**
+         * @brief Perform tests on encode kernels
+         *
+         */
+        void performEncodeKernelTests();
+};
+
+END_NAMESPACE_LIBIHEX
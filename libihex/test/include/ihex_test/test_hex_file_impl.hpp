@@ -83,6 +83,66 @@ class HexFileTest : public testing::Test
          */
         void performLoadSaveFileTests();
 
+        /**
+         * @brief Perform tests on loading from memory and mapped files
+         *
+         */
+        void performLoadMemoryTests();
+
+        /**
+         * @brief Perform tests on parallel loading
+         *
+         */
+        void performLoadParallelTests();
+
+        /**
+         * @brief Perform tests on parallel saving
+         *
+         */
+        void performSaveParallelTests();
+
+        /**
+         * @brief Perform tests on saving to sinks with line separators
+         *
+         */
+        void performSaveSinkTests();
+
+        /**
+         * @brief Perform tests on saving with record data size and alignment
+         *
+         */
+        void performSaveRecordLayoutTests();
+
+        /**
+         * @brief Perform tests on saving with the cache of the encoded sections
+         *
+         */
+        void performSaveCacheTests();
+
+        /**
+         * @brief Perform tests on loading to the page storage
+         *
+         */
+        void performPageStorageTests();
+
+        /**
+         * @brief Perform tests on loading with the allocator
+         *
+         */
+        void performAllocatorTests();
+
+        /**
+         * @brief Perform tests on validate() functions
+         *
+         */
+        void performValidateTests();
+
+        /**
+         * @brief Perform tests on loading with diagnostics
+         *
+         */
+        void performDiagnosticsTests();
+
         /**
          * @brief Perform tests on property functions
          *
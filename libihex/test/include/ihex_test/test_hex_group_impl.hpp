@@ -89,6 +89,12 @@ class HexGroupTest : public testing::Test
          */
         void performGetSetUnusedDataFillValueTests();
 
+        /**
+         * @brief Perform tests on get/setSectionStorageType() functions
+         *
+         */
+        void performGetSetSectionStorageTypeTests();
+
         /**
          * @brief Perform tests on getAddressMap() function
          *
@@ -197,6 +203,30 @@ class HexGroupTest : public testing::Test
          */
         void performStartLinearAddressTests();
 
+        /**
+         * @brief Perform tests on the section lookup by the absolute address
+         *
+         */
+        void performAddressIndexTests();
+
+        /**
+         * @brief Perform tests on the group type and the address ranges of the sections
+         *
+         */
+        void performAddressRangeTests();
+
+        /**
+         * @brief Perform tests on the lookups after changing the sections through the references
+         *
+         */
+        void performSectionReferenceTests();
+
+        /**
+         * @brief Perform tests on copying the groups with referenced data
+         *
+         */
+        void performDataReferenceTests();
+
         /**
          * @brief Pointer to a test group
          *
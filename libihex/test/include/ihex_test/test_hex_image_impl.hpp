@@ -0,0 +1,81 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <ihex/hex_image.hpp>
+#include <ihex/version.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief HexImageTest class
+ *
+ */
+class HexImageTest : public testing::Test
+{
+    public:
+        /**
+         * @brief Construct a new HexImageTest object
+         *
+         */
+        HexImageTest();
+
+        /**
+         * @brief Destroy the HexImageTest object
+         *
+         */
+        virtual ~HexImageTest();
+
+    protected:
+        /**
+         * @brief Set up the test
+         *
+         */
+        virtual void SetUp() override;
+
+        /**
+         * @brief Tear down the test
+         *
+         */
+        virtual void TearDown() override;
+
+        /**
+         * @brief Perform tests on owned vector images
+         *
+         */
+        void performVectorTests();
+
+        /**
+         * @brief Perform tests on caller buffer images
+         *
+         */
+        void performBufferTests();
+
+        /**
+         * @brief Perform tests on written address ranges
+         *
+         */
+        void performWrittenMapTests();
+};
+
+END_NAMESPACE_LIBIHEX
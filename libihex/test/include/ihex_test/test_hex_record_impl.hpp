@@ -137,6 +137,18 @@ class HexRecordTest : public testing::Test
          */
         void performSetRecordTests();
 
+        /**
+         * @brief Perform tests on encode() and getRecordLength() functions
+         *
+         */
+        void performEncodeTests();
+
+        /**
+         * @brief Perform tests on HexRecordView class
+         *
+         */
+        void performRecordViewTests();
+
         /**
          * @brief Perform tests on checksum functions
          *
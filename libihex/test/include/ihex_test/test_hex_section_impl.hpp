@@ -221,6 +221,60 @@ class HexSectionTest : public testing::Test
          */
         void performCompactTests();
 
+        /**
+         * @brief Perform tests on begin() and end() record iterators
+         *
+         */
+        void performRecordIteratorTests();
+
+        /**
+         * @brief Perform tests on record iterators re-chunking the data
+         *
+         */
+        void performRecordLayoutTests();
+
+        /**
+         * @brief Perform tests on getRevision() function
+         *
+         */
+        void performRevisionTests();
+
+        /**
+         * @brief Perform tests on the page storage
+         *
+         */
+        void performStorageTests();
+
+        /**
+         * @brief Perform tests on the data block lookups
+         *
+         */
+        void performLookupTests();
+
+        /**
+         * @brief Perform tests on the layout of the pushed records
+         *
+         */
+        void performPushLayoutTests();
+
+        /**
+         * @brief Perform tests on the allocator support
+         *
+         */
+        void performAllocatorTests();
+
+        /**
+         * @brief Perform tests on sharing the data between the copies
+         *
+         */
+        void performCopyOnWriteTests();
+
+        /**
+         * @brief Perform tests on copying the sections with referenced data
+         *
+         */
+        void performDataReferenceTests();
+
         /**
          * @brief Pointer to a test section
          *
@@ -0,0 +1,200 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <map>
+#include <string_view>
+#include <gtest/gtest.h>
+#include <ihex/hex_visitor.hpp>
+#include <ihex/version.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief HexRecordingVisitor class, records all the callbacks
+ *
+ */
+class HexRecordingVisitor : public HexVisitor
+{
+    public:
+        /**
+         * @brief Data runs (absolute address and size)
+         *
+         */
+        HexAddressMap runs{};
+
+        /**
+         * @brief Visited data
+         *
+         */
+        std::map<HexAddressType, HexDataType> data{};
+
+        /**
+         * @brief Number of RECORD_END_OF_FILE records
+         *
+         */
+        size_t endOfFileCount{0};
+
+        /**
+         * @brief Last extended segment address
+         *
+         */
+        uint16_t segmentAddress{0};
+
+        /**
+         * @brief Last start segment address (code segment and instruction pointer)
+         *
+         */
+        uint32_t startSegmentAddress{0};
+
+        /**
+         * @brief Last extended linear address
+         *
+         */
+        uint16_t linearAddress{0};
+
+        /**
+         * @brief Last start linear address
+         *
+         */
+        uint32_t startLinearAddress{0};
+
+        /**
+         * @brief Number of invalid records
+         *
+         */
+        size_t invalidRecordCount{0};
+
+        /**
+         * @brief Number of records with checksum mismatch
+         *
+         */
+        size_t checksumMismatchCount{0};
+
+        /**
+         * @brief Continue the visit on errors
+         *
+         */
+        bool continueOnError{true};
+
+    protected:
+        /**
+         * @brief Record the data run
+         *
+         */
+        virtual void onData(HexAddressType address, const HexDataType* data, HexDataSizeType dataSize) override;
+
+        /**
+         * @brief Count the RECORD_END_OF_FILE record
+         *
+         */
+        virtual void onEndOfFile() override;
+
+        /**
+         * @brief Record the extended segment address
+         *
+         */
+        virtual void onExtendedSegmentAddress(uint16_t segmentAddress) override;
+
+        /**
+         * @brief Record the start segment address
+         *
+         */
+        virtual void onStartSegmentAddress(uint16_t codeSegment, uint16_t instructionPointer) override;
+
+        /**
+         * @brief Record the extended linear address
+         *
+         */
+        virtual void onExtendedLinearAddress(uint16_t linearAddress) override;
+
+        /**
+         * @brief Record the start linear address
+         *
+         */
+        virtual void onStartLinearAddress(uint32_t extendedInstructionPointer) override;
+
+        /**
+         * @brief Count the invalid record
+         *
+         */
+        virtual bool onInvalidRecord(std::string_view line) override;
+
+        /**
+         * @brief Count the record with checksum mismatch
+         *
+         */
+        virtual bool onChecksumMismatch(std::string_view line) override;
+};
+
+/**
+ * @brief HexVisitorTest class
+ *
+ */
+class HexVisitorTest : public testing::Test
+{
+    public:
+        /**
+         * @brief Construct a new HexVisitorTest object
+         *
+         */
+        HexVisitorTest();
+
+        /**
+         * @brief Destroy the HexVisitorTest object
+         *
+         */
+        virtual ~HexVisitorTest();
+
+    protected:
+        /**
+         * @brief Set up the test
+         *
+         */
+        virtual void SetUp() override;
+
+        /**
+         * @brief Tear down the test
+         *
+         */
+        virtual void TearDown() override;
+
+        /**
+         * @brief Perform tests on visit() functions
+         *
+         */
+        void performVisitTests();
+
+        /**
+         * @brief Perform tests on absolute address resolution
+         *
+         */
+        void performAddressTests();
+
+        /**
+         * @brief Perform tests on invalid records
+         *
+         */
+        void performInvalidTests();
+};
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <ihex/hex_writer.hpp>
+#include <ihex/version.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+/**
+ * @brief HexWriterTest class
+ *
+ */
+class HexWriterTest : public testing::Test
+{
+    public:
+        /**
+         * @brief Construct a new HexWriterTest object
+         *
+         */
+        HexWriterTest();
+
+        /**
+         * @brief Destroy the HexWriterTest object
+         *
+         */
+        virtual ~HexWriterTest();
+
+    protected:
+        /**
+         * @brief Set up the test
+         *
+         */
+        virtual void SetUp() override;
+
+        /**
+         * @brief Tear down the test
+         *
+         */
+        virtual void TearDown() override;
+
+        /**
+         * @brief Perform tests on HexWriter constructor and property functions
+         *
+         */
+        void performConstructorTests();
+
+        /**
+         * @brief Perform tests on writing sorted data
+         *
+         */
+        void performWriteTests();
+
+        /**
+         * @brief Perform tests on writing unsorted data within the window
+         *
+         */
+        void performWindowTests();
+
+        /**
+         * @brief Perform tests on extended address records
+         *
+         */
+        void performExtendedAddressTests();
+
+        /**
+         * @brief Perform tests on finish() and start address records
+         *
+         */
+        void performFinishTests();
+};
+
+END_NAMESPACE_LIBIHEX
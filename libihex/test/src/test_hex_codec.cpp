@@ -0,0 +1,57 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <gtest/gtest.h>
+#include <ihex_test/test_hex_codec_impl.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+TEST_F(HexCodecTest, DecodeDigitTests)
+{
+    SCOPED_TRACE("DecodeDigitTests");
+    performDecodeDigitTests();
+}
+
+TEST_F(HexCodecTest, DecodeTests)
+{
+    SCOPED_TRACE("DecodeTests");
+    performDecodeTests();
+}
+
+TEST_F(HexCodecTest, DecodeKernelTests)
+{
+    SCOPED_TRACE("DecodeKernelTests");
+    performDecodeKernelTests();
+}
+
+TEST_F(HexCodecTest, EncodeTests)
+{
+    SCOPED_TRACE("EncodeTests");
+    performEncodeTests();
+}
+
+TEST_F(HexCodecTest, EncodeKernelTests)
+{
+    SCOPED_TRACE("EncodeKernelTests");
+    performEncodeKernelTests();
+}
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,290 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <stdexcept>
+#include <string>
+#include <gtest/gtest.h>
+#include <ihex/hex_codec.hpp>
+#include <ihex_test/test_hex_codec_impl.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+HexCodecTest::HexCodecTest()
+{
+
+}
+
+HexCodecTest::~HexCodecTest()
+{
+
+}
+
+void HexCodecTest::SetUp()
+{
+    Test::SetUp();
+}
+
+void HexCodecTest::TearDown()
+{
+    Test::TearDown();
+}
+
+void HexCodecTest::performDecodeDigitTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Every character is either a valid digit or rejected
+    for (int character{0}; character < 256; ++character)
+    {
+        HexDataType value{0};
+        auto result{HexCodec::decodeNibble(static_cast<char>(character), value)};
+
+        if ((character >= '0') && (character <= '9'))
+        {
+            ASSERT_TRUE(result);
+            ASSERT_EQ(value, character - '0');
+        }
+        else if ((character >= 'A') && (character <= 'F'))
+        {
+            ASSERT_TRUE(result);
+            ASSERT_EQ(value, character - 'A' + 10);
+        }
+        else if ((character >= 'a') && (character <= 'f'))
+        {
+            ASSERT_TRUE(result);
+            ASSERT_EQ(value, character - 'a' + 10);
+        }
+        else
+            ASSERT_FALSE(result);
+    }
+
+    // Bytes
+    HexDataType byte{0};
+    ASSERT_TRUE(HexCodec::decodeByte("00", byte));
+    ASSERT_EQ(byte, 0x00);
+    ASSERT_TRUE(HexCodec::decodeByte("7f", byte));
+    ASSERT_EQ(byte, 0x7F);
+    ASSERT_TRUE(HexCodec::decodeByte("A5", byte));
+    ASSERT_EQ(byte, 0xA5);
+    ASSERT_TRUE(HexCodec::decodeByte("FF", byte));
+    ASSERT_EQ(byte, 0xFF);
+    ASSERT_FALSE(HexCodec::decodeByte("G0", byte));
+    ASSERT_FALSE(HexCodec::decodeByte("0G", byte));
+    ASSERT_FALSE(HexCodec::decodeByte(" 1", byte));
+    ASSERT_FALSE(HexCodec::decodeByte("1\n", byte));
+
+    // Words
+    uint16_t word{0};
+    ASSERT_TRUE(HexCodec::decodeWord("0000", word));
+    ASSERT_EQ(word, 0x0000);
+    ASSERT_TRUE(HexCodec::decodeWord("3A4b", word));
+    ASSERT_EQ(word, 0x3A4B);
+    ASSERT_TRUE(HexCodec::decodeWord("FFFF", word));
+    ASSERT_EQ(word, 0xFFFF);
+    ASSERT_FALSE(HexCodec::decodeWord("FFFX", word));
+    ASSERT_FALSE(HexCodec::decodeWord("X000", word));
+}
+
+void HexCodecTest::performDecodeTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Decode every possible byte value in both letter cases
+    std::string upper;
+    std::string lower;
+    const char* digitsUpper{"0123456789ABCDEF"};
+    const char* digitsLower{"0123456789abcdef"};
+    for (unsigned int value{0}; value < 256; ++value)
+    {
+        upper.push_back(digitsUpper[value >> 4]);
+        upper.push_back(digitsUpper[value & 0x0F]);
+        lower.push_back(digitsLower[value >> 4]);
+        lower.push_back(digitsLower[value & 0x0F]);
+    }
+
+    HexDataVector data(256, 0);
+    ASSERT_TRUE(HexCodec::decode(upper.c_str(), data.data(), data.size()));
+    for (HexDataSizeType index{0}; index < data.size(); ++index)
+        ASSERT_EQ(data[index], index);
+
+    data.assign(256, 0);
+    ASSERT_TRUE(HexCodec::decode(lower.c_str(), data.data(), data.size()));
+    for (HexDataSizeType index{0}; index < data.size(); ++index)
+        ASSERT_EQ(data[index], index);
+
+    // Empty input
+    ASSERT_TRUE(HexCodec::decode("", data.data(), 0));
+
+    // Invalid digit at every position is detected
+    for (HexDataSizeType position{0}; position < upper.size(); ++position)
+    {
+        std::string invalid{upper};
+        invalid[position] = 'g';
+        ASSERT_FALSE(HexCodec::decode(invalid.c_str(), data.data(), data.size()));
+    }
+
+    // Only the requested size is decoded
+    data.assign(4, 0xAA);
+    ASSERT_TRUE(HexCodec::decode("0102XXXX", data.data(), 2));
+    ASSERT_EQ(data[0], 0x01);
+    ASSERT_EQ(data[1], 0x02);
+    ASSERT_EQ(data[2], 0xAA);
+    ASSERT_EQ(data[3], 0xAA);
+}
+
+void HexCodecTest::performDecodeKernelTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Scalar kernel is always available and the selected kernel is supported
+    ASSERT_TRUE(HexCodec::isKernelSupported(HexCodecKernelType::KERNEL_SCALAR));
+    ASSERT_TRUE(HexCodec::isKernelSupported(HexCodec::getKernel()));
+    ASSERT_FALSE(HexCodec::isKernelSupported(static_cast<HexCodecKernelType>(0xFF)));
+    ASSERT_THROW(HexCodec::decode(static_cast<HexCodecKernelType>(0xFF), "00", nullptr, 0), std::domain_error);
+
+    // Record sized data with mixed letter case
+    std::string text;
+    const char* digits{"0123456789ABCDEFabcdef"};
+    for (HexDataSizeType index{0}; index < (2 * MAXIMUM_HEX_RECORD_DATA_SIZE); ++index)
+        text.push_back(digits[(index * 7 + 3) % 22]);
+
+    HexDataVector expected(MAXIMUM_HEX_RECORD_DATA_SIZE, 0);
+    ASSERT_TRUE(HexCodec::decode(HexCodecKernelType::KERNEL_SCALAR, text.c_str(), expected.data(), expected.size()));
+
+    for (auto kernel{static_cast<uint8_t>(HexCodecKernelType::KERNEL_MIN)}; kernel <= static_cast<uint8_t>(HexCodecKernelType::KERNEL_MAX); ++kernel)
+    {
+        auto kernelType{static_cast<HexCodecKernelType>(kernel)};
+        if (!HexCodec::isKernelSupported(kernelType))
+        {
+            ASSERT_THROW(HexCodec::decode(kernelType, "00", nullptr, 0), std::domain_error);
+            continue;
+        }
+
+        // Every size exercises the vector steps and the scalar tail
+        for (HexDataSizeType size{0}; size <= MAXIMUM_HEX_RECORD_DATA_SIZE; ++size)
+        {
+            HexDataVector data(size + 1, 0x5A);
+            ASSERT_TRUE(HexCodec::decode(kernelType, text.c_str(), data.data(), size));
+            for (HexDataSizeType index{0}; index < size; ++index)
+                ASSERT_EQ(data[index], expected[index]);
+            ASSERT_EQ(data[size], 0x5A);
+        }
+
+        // Invalid digits are detected at every position
+        HexDataVector data(64, 0);
+        for (HexDataSizeType position{0}; position < 128; ++position)
+        {
+            for (char invalidCharacter : {'g', 'G', '/', ':', '@', '`', ' ', '\x80', '\xC1'})
+            {
+                std::string invalid{text.substr(0, 128)};
+                invalid[position] = invalidCharacter;
+                ASSERT_FALSE(HexCodec::decode(kernelType, invalid.c_str(), data.data(), data.size()));
+            }
+        }
+    }
+}
+
+void HexCodecTest::performEncodeTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Encode every possible byte value
+    const char* digits{"0123456789ABCDEF"};
+    for (unsigned int value{0}; value < 256; ++value)
+    {
+        char text[2]{};
+        HexCodec::encodeByte(static_cast<HexDataType>(value), text);
+        ASSERT_EQ(text[0], digits[value >> 4]);
+        ASSERT_EQ(text[1], digits[value & 0x0F]);
+    }
+
+    // Encode words (most significant digit first)
+    char word[5]{};
+    HexCodec::encodeWord(0x0000, word);
+    ASSERT_EQ(std::string(word), "0000");
+    HexCodec::encodeWord(0x1A2B, word);
+    ASSERT_EQ(std::string(word), "1A2B");
+    HexCodec::encodeWord(0xFFFF, word);
+    ASSERT_EQ(std::string(word), "FFFF");
+
+    // Encoded data decodes back to the same data
+    HexDataVector data(256, 0);
+    for (HexDataSizeType index{0}; index < data.size(); ++index)
+        data[index] = static_cast<HexDataType>(index);
+
+    std::string text(2 * data.size(), 'X');
+    HexCodec::encode(data.data(), data.size(), text.data());
+    HexDataVector decoded(data.size(), 0);
+    ASSERT_TRUE(HexCodec::decode(text.c_str(), decoded.data(), decoded.size()));
+    ASSERT_EQ(decoded, data);
+
+    // Only the requested size is encoded
+    text.assign(8, 'X');
+    HexCodec::encode(data.data() + 1, 2, text.data());
+    ASSERT_EQ(text, "0102XXXX");
+
+    // Empty input
+    HexCodec::encode(data.data(), 0, text.data());
+    ASSERT_EQ(text, "0102XXXX");
+}
+
+void HexCodecTest::performEncodeKernelTests()
+{
+    SCOPED_TRACE(__func__);
+
+    ASSERT_THROW(HexCodec::encode(static_cast<HexCodecKernelType>(0xFF), nullptr, 0, nullptr), std::domain_error);
+
+    // Record sized data covering all of the nibble values
+    HexDataVector data(MAXIMUM_HEX_RECORD_DATA_SIZE, 0);
+    for (HexDataSizeType index{0}; index < data.size(); ++index)
+        data[index] = static_cast<HexDataType>((index * 37) + 11);
+
+    std::string expected(2 * data.size(), 'X');
+    HexCodec::encode(HexCodecKernelType::KERNEL_SCALAR, data.data(), data.size(), expected.data());
+    for (HexDataSizeType index{0}; index < data.size(); ++index)
+    {
+        char digits[2]{};
+        HexCodec::encodeByte(data[index], digits);
+        ASSERT_EQ(expected[2 * index], digits[0]);
+        ASSERT_EQ(expected[(2 * index) + 1], digits[1]);
+    }
+
+    for (auto kernel{static_cast<uint8_t>(HexCodecKernelType::KERNEL_MIN)}; kernel <= static_cast<uint8_t>(HexCodecKernelType::KERNEL_MAX); ++kernel)
+    {
+        auto kernelType{static_cast<HexCodecKernelType>(kernel)};
+        if (!HexCodec::isKernelSupported(kernelType))
+        {
+            ASSERT_THROW(HexCodec::encode(kernelType, data.data(), 0, nullptr), std::domain_error);
+            continue;
+        }
+
+        // Every size exercises the vector steps and the scalar tail
+        for (HexDataSizeType size{0}; size <= MAXIMUM_HEX_RECORD_DATA_SIZE; ++size)
+        {
+            std::string text((2 * size) + 1, 'X');
+            HexCodec::encode(kernelType, data.data(), size, text.data());
+            ASSERT_EQ(text.substr(0, 2 * size), expected.substr(0, 2 * size));
+            ASSERT_EQ(text[2 * size], 'X');
+        }
+    }
+}
+
+END_NAMESPACE_LIBIHEX
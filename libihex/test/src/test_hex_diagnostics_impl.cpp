@@ -0,0 +1,100 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <gtest/gtest.h>
+#include <ihex/hex_diagnostics.hpp>
+#include <ihex_test/test_hex_diagnostics_impl.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+HexDiagnosticsTest::HexDiagnosticsTest()
+{
+
+}
+
+HexDiagnosticsTest::~HexDiagnosticsTest()
+{
+
+}
+
+void HexDiagnosticsTest::SetUp()
+{
+    Test::SetUp();
+}
+
+void HexDiagnosticsTest::TearDown()
+{
+    Test::TearDown();
+}
+
+void HexDiagnosticsTest::performConstructorTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Default maximum number of errors
+    HexDiagnostics diagnostics{};
+    ASSERT_EQ(diagnostics.getMaximumErrorCount(), DEFAULT_HEX_DIAGNOSTICS_ERROR_COUNT);
+    ASSERT_EQ(diagnostics.getErrorCount(), 0);
+    ASSERT_FALSE(diagnostics.hasErrors());
+    ASSERT_FALSE(diagnostics.isFull());
+    ASSERT_GE(diagnostics.getErrors().capacity(), DEFAULT_HEX_DIAGNOSTICS_ERROR_COUNT);
+
+    // Custom maximum number of errors
+    HexDiagnostics customDiagnostics{3};
+    ASSERT_EQ(customDiagnostics.getMaximumErrorCount(), 3);
+    ASSERT_GE(customDiagnostics.getErrors().capacity(), 3);
+
+    // No errors are kept
+    HexDiagnostics emptyDiagnostics{0};
+    ASSERT_TRUE(emptyDiagnostics.isFull());
+}
+
+void HexDiagnosticsTest::performPushErrorTests()
+{
+    SCOPED_TRACE(__func__);
+
+    HexDiagnostics diagnostics{2};
+    ASSERT_TRUE(diagnostics.pushError(HexError{1, 0, HexErrorType::ERROR_INVALID_RECORD}));
+    ASSERT_TRUE(diagnostics.hasErrors());
+    ASSERT_FALSE(diagnostics.isFull());
+    ASSERT_TRUE(diagnostics.pushError(HexError{3, 40, HexErrorType::ERROR_CHECKSUM_MISMATCH}));
+    ASSERT_TRUE(diagnostics.isFull());
+
+    // Errors past the maximum are counted only
+    ASSERT_FALSE(diagnostics.pushError(HexError{5, 80, HexErrorType::ERROR_INVALID_RECORD}));
+    ASSERT_EQ(diagnostics.getErrorCount(), 3);
+    ASSERT_EQ(diagnostics.getErrors().size(), 2);
+    ASSERT_EQ(diagnostics.getErrors().at(0).line, 1);
+    ASSERT_EQ(diagnostics.getErrors().at(0).offset, 0);
+    ASSERT_EQ(diagnostics.getErrors().at(0).errorType, HexErrorType::ERROR_INVALID_RECORD);
+    ASSERT_EQ(diagnostics.getErrors().at(1).line, 3);
+    ASSERT_EQ(diagnostics.getErrors().at(1).offset, 40);
+    ASSERT_EQ(diagnostics.getErrors().at(1).errorType, HexErrorType::ERROR_CHECKSUM_MISMATCH);
+
+    // Clear keeps the maximum number of errors
+    diagnostics.clear();
+    ASSERT_EQ(diagnostics.getErrorCount(), 0);
+    ASSERT_EQ(diagnostics.getErrors().size(), 0);
+    ASSERT_FALSE(diagnostics.hasErrors());
+    ASSERT_EQ(diagnostics.getMaximumErrorCount(), 2);
+}
+
+END_NAMESPACE_LIBIHEX
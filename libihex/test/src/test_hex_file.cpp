@@ -48,6 +48,66 @@ TEST_F(HexFileTest, LoadSaveFileTests)
     performLoadSaveFileTests();
 }
 
+TEST_F(HexFileTest, LoadMemoryTests)
+{
+    SCOPED_TRACE("LoadMemoryTests");
+    performLoadMemoryTests();
+}
+
+TEST_F(HexFileTest, LoadParallelTests)
+{
+    SCOPED_TRACE("LoadParallelTests");
+    performLoadParallelTests();
+}
+
+TEST_F(HexFileTest, SaveParallelTests)
+{
+    SCOPED_TRACE("SaveParallelTests");
+    performSaveParallelTests();
+}
+
+TEST_F(HexFileTest, SaveSinkTests)
+{
+    SCOPED_TRACE("SaveSinkTests");
+    performSaveSinkTests();
+}
+
+TEST_F(HexFileTest, SaveRecordLayoutTests)
+{
+    SCOPED_TRACE("SaveRecordLayoutTests");
+    performSaveRecordLayoutTests();
+}
+
+TEST_F(HexFileTest, SaveCacheTests)
+{
+    SCOPED_TRACE("SaveCacheTests");
+    performSaveCacheTests();
+}
+
+TEST_F(HexFileTest, PageStorageTests)
+{
+    SCOPED_TRACE("PageStorageTests");
+    performPageStorageTests();
+}
+
+TEST_F(HexFileTest, AllocatorTests)
+{
+    SCOPED_TRACE("AllocatorTests");
+    performAllocatorTests();
+}
+
+TEST_F(HexFileTest, ValidateTests)
+{
+    SCOPED_TRACE("ValidateTests");
+    performValidateTests();
+}
+
+TEST_F(HexFileTest, DiagnosticsTests)
+{
+    SCOPED_TRACE("DiagnosticsTests");
+    performDiagnosticsTests();
+}
+
 TEST_F(HexFileTest, PropertiesTests)
 {
     SCOPED_TRACE("PropertiesTests");
@@ -19,6 +19,15 @@
     SPDX-License-Identifier: GPL-3.0-or-later
 */
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <ihex/hex_parser.hpp>
 #include <ihex_test/test_hex_file_assets.hpp>
 #include <ihex_test/test_hex_file_impl.hpp>
 
@@ -731,6 +740,841 @@ void HexFileTest::performLoadSaveFileTests()
     ASSERT_TRUE(file->save(std::string(TEST_HEX_FILE_ASSET_PATH) + "/invalid_sample_out.hex"));
 }
 
+void HexFileTest::performLoadMemoryTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Memory-mapped, stream and memory loading produce the same file
+    for (const auto& sample : {"sample1.hex", "sample2.hex"})
+    {
+        auto fileName{std::string(TEST_HEX_FILE_ASSET_PATH) + "/" + sample};
+        std::ifstream input{fileName};
+        std::string contents{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+
+        HexFile mappedFile{};
+        ASSERT_TRUE(mappedFile.load(fileName));
+        std::stringstream mappedOutput{};
+        ASSERT_TRUE(mappedFile.save(mappedOutput));
+
+        HexFile streamFile{};
+        std::stringstream streamInput{contents};
+        ASSERT_TRUE(streamFile.load(streamInput));
+        std::stringstream streamOutput{};
+        ASSERT_TRUE(streamFile.save(streamOutput));
+
+        HexFile memoryFile{};
+        ASSERT_TRUE(memoryFile.load(contents.data(), contents.size()));
+        std::stringstream memoryOutput{};
+        ASSERT_TRUE(memoryFile.save(memoryOutput));
+
+        ASSERT_GT(mappedFile.getSize(), 0);
+        ASSERT_EQ(mappedOutput.str(), streamOutput.str());
+        ASSERT_EQ(memoryOutput.str(), streamOutput.str());
+    }
+
+    // Empty input
+    ASSERT_TRUE(file->load(nullptr, 0));
+    ASSERT_EQ(file->getSize(), 0);
+
+    auto emptyFileName{std::string(TEST_HEX_FILE_ASSET_PATH) + "/empty_sample.hex"};
+    std::ofstream{emptyFileName}.close();
+    ASSERT_TRUE(file->load(emptyFileName));
+    ASSERT_EQ(file->getSize(), 0);
+
+    // Empty lines, carriage returns and missing trailing line separator
+    std::string contents{"\n:04000000D8BCDA7816\r\n\n:06700000505D6C94AFA589\r\n:00000001FF"};
+    ASSERT_TRUE(file->load(contents.data(), contents.size()));
+    ASSERT_EQ(file->getSize(), 2);
+    ASSERT_EQ(file->getSection(0).getSize(), 2);
+    ASSERT_EQ(file->getSection(1).getSectionType(), HexSectionType::SECTION_END_OF_FILE);
+    ASSERT_EQ(file->getData(0x0003), 0x78);
+    ASSERT_EQ(file->getData(0x7005), 0xA5);
+
+    // Only the provided size is loaded
+    file->clearSections();
+    ASSERT_TRUE(file->load(contents.data(), contents.size() - 11));
+    ASSERT_EQ(file->getSize(), 1);
+    ASSERT_EQ(file->getSection(0).getSectionType(), HexSectionType::SECTION_DATA);
+
+    // Invalid record and checksum mismatch
+    std::string invalidContents{":04000000D8BCDA7816\n:xyz\n:06700000505D6C94AFA588\n:00000001FF\n"};
+    file->clearSections();
+    file->setThrowOnInvalidRecord(false);
+    file->setThrowOnChecksumMismatch(false);
+    ASSERT_FALSE(file->load(invalidContents.data(), invalidContents.size()));
+    ASSERT_EQ(file->getSize(), 2);
+    ASSERT_EQ(file->getSection(0).getSize(), 1);
+
+    file->clearSections();
+    file->setThrowOnInvalidRecord(true);
+    ASSERT_THROW(file->load(invalidContents.data(), invalidContents.size()), std::runtime_error);
+    ASSERT_EQ(file->getSize(), 1);
+
+    file->clearSections();
+    file->setThrowOnInvalidRecord(false);
+    file->setThrowOnChecksumMismatch(true);
+    ASSERT_THROW(file->load(invalidContents.data(), invalidContents.size()), std::logic_error);
+    ASSERT_EQ(file->getSize(), 1);
+
+    // Invalid record in a memory-mapped file
+    auto invalidFileName{std::string(TEST_HEX_FILE_ASSET_PATH) + "/invalid_record_sample.hex"};
+    std::ofstream{invalidFileName} << invalidContents;
+
+    file->clearSections();
+    file->setThrowOnInvalidRecord(true);
+    file->setThrowOnChecksumMismatch(true);
+    ASSERT_THROW(file->load(invalidFileName), std::runtime_error);
+
+    file->clearSections();
+    file->setThrowOnInvalidRecord(false);
+    file->setThrowOnChecksumMismatch(false);
+    ASSERT_FALSE(file->load(invalidFileName));
+    ASSERT_EQ(file->getSize(), 2);
+}
+
+void HexFileTest::performLoadParallelTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Generate sections of pseudo-random data records
+    uint32_t seed{0x12345678};
+    auto appendSection{[&seed](std::string& contents, const HexRecord& sectionRecord, size_t recordCount)
+    {
+        contents += sectionRecord.getRecord() + "\n";
+        for (size_t index{0}; index < recordCount; ++index)
+        {
+            HexDataVector data(DEFAULT_HEX_RECORD_DATA_SIZE);
+            for (auto& dataItem : data)
+            {
+                seed = (seed * 1103515245U) + 12345U;
+                dataItem = static_cast<HexDataType>(seed >> 16);
+            }
+            contents += HexRecord::makeDataRecord(static_cast<HexDataAddressType>(index * data.size()), data).getRecord() + "\n";
+        }
+    }};
+
+    // Load the contents sequentially and in parallel and compare the results
+    auto compareLoad{[](const std::string& contents, bool throwOnError, size_t threadCount)
+    {
+        HexFile sequentialFile{};
+        sequentialFile.setThrowOnInvalidRecord(throwOnError);
+        sequentialFile.setThrowOnChecksumMismatch(throwOnError);
+        bool sequentialResult{false};
+        bool sequentialThrown{false};
+        try
+        {
+            sequentialResult = sequentialFile.load(contents.data(), contents.size());
+        }
+        catch (const std::exception&)
+        {
+            sequentialThrown = true;
+        }
+
+        HexFile parallelFile{};
+        parallelFile.setThreadCount(threadCount);
+        parallelFile.setThrowOnInvalidRecord(throwOnError);
+        parallelFile.setThrowOnChecksumMismatch(throwOnError);
+        bool parallelResult{false};
+        bool parallelThrown{false};
+        try
+        {
+            parallelResult = parallelFile.load(contents.data(), contents.size());
+        }
+        catch (const std::exception&)
+        {
+            parallelThrown = true;
+        }
+
+        ASSERT_EQ(parallelThrown, sequentialThrown);
+        ASSERT_EQ(parallelResult, sequentialResult);
+        ASSERT_EQ(parallelFile.getSize(), sequentialFile.getSize());
+        for (size_t index{0}; index < sequentialFile.getSize(); ++index)
+        {
+            ASSERT_EQ(parallelFile.getSection(index).getSectionType(), sequentialFile.getSection(index).getSectionType());
+            ASSERT_EQ(parallelFile.getSection(index).getSize(), sequentialFile.getSection(index).getSize());
+        }
+
+        std::stringstream sequentialOutput{};
+        std::stringstream parallelOutput{};
+        ASSERT_TRUE(sequentialFile.save(sequentialOutput));
+        ASSERT_TRUE(parallelFile.save(parallelOutput));
+        ASSERT_EQ(parallelOutput.str(), sequentialOutput.str());
+    }};
+
+    // ADDRESS_I32HEX
+    std::string linearContents;
+    for (uint16_t section{0}; section < 48; ++section)
+    {
+        appendSection(linearContents, HexRecord::makeExtendedLinearAddressRecord(section), 64);
+        if (section == 20)
+            linearContents += HexRecord::makeStartLinearAddressRecord(0x00200000).getRecord() + "\n";
+    }
+    linearContents += HexRecord::makeEndOfFileRecord().getRecord() + "\n";
+
+    for (size_t threadCount : {0, 2, 3, 8})
+    {
+        SCOPED_TRACE(threadCount);
+        compareLoad(linearContents, true, threadCount);
+        compareLoad(linearContents, false, threadCount);
+    }
+
+    HexFile linearFile{};
+    linearFile.setThreadCount(4);
+    ASSERT_TRUE(linearFile.load(linearContents.data(), linearContents.size()));
+    ASSERT_EQ(linearFile.getSize(), 50);
+    ASSERT_EQ(linearFile.getGroupType(), HexAddressEnumType::ADDRESS_I32HEX);
+
+    // ADDRESS_I16HEX with end of file record in the middle and repeated sections
+    std::string segmentContents;
+    for (uint16_t section{0}; section < 40; ++section)
+    {
+        appendSection(segmentContents, HexRecord::makeExtendedSegmentAddressRecord(static_cast<uint16_t>((section % 30) * 0x1000)), 64);
+        if (section == 10)
+            segmentContents += HexRecord::makeEndOfFileRecord().getRecord() + "\n";
+        if (section == 25)
+            segmentContents += HexRecord::makeStartSegmentAddressRecord(0x1000, 0x0100).getRecord() + "\n";
+    }
+
+    for (size_t threadCount : {2, 5})
+    {
+        SCOPED_TRACE(threadCount);
+        compareLoad(segmentContents, true, threadCount);
+        compareLoad(segmentContents, false, threadCount);
+    }
+
+    // Mixed address formats (rejected sections)
+    std::string mixedContents{linearContents.substr(0, linearContents.size() / 2)};
+    appendSection(mixedContents, HexRecord::makeExtendedSegmentAddressRecord(0x2000), 200);
+    mixedContents += linearContents.substr(linearContents.size() / 2);
+
+    compareLoad(mixedContents, true, 4);
+    compareLoad(mixedContents, false, 4);
+
+    // Invalid records and checksum mismatches in different chunks
+    std::string invalidContents{linearContents};
+    for (size_t position : {invalidContents.size() / 5, invalidContents.size() / 2, (invalidContents.size() * 4) / 5})
+    {
+        // Corrupt the checksum of the record at the position
+        auto lineEnd{invalidContents.find('\n', position)};
+        invalidContents[lineEnd - 1] = ((invalidContents[lineEnd - 1] == '0') ? '1' : '0');
+    }
+
+    auto lineEnd{invalidContents.find('\n', invalidContents.size() / 3)};
+    invalidContents.insert(lineEnd + 1, ":xyz\n");
+
+    for (size_t threadCount : {2, 4})
+    {
+        SCOPED_TRACE(threadCount);
+        compareLoad(invalidContents, true, threadCount);
+        compareLoad(invalidContents, false, threadCount);
+    }
+
+    // Loading appends to existing sections
+    HexFile appendedFile{};
+    appendedFile.setThreadCount(4);
+    ASSERT_TRUE(appendedFile.load(linearContents.data(), linearContents.find('\n', linearContents.size() / 2) + 1));
+    auto size{appendedFile.getSize()};
+    ASSERT_TRUE(appendedFile.load(linearContents.data(), linearContents.size()));
+    ASSERT_GE(appendedFile.getSize(), size);
+}
+
+void HexFileTest::performSaveParallelTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Large sections, which fill the chunks, and many small sections
+    std::string contents;
+    uint32_t seed{0x87654321};
+    for (uint16_t section{0}; section < 3; ++section)
+    {
+        contents += HexRecord::makeExtendedLinearAddressRecord(section).getRecord() + "\n";
+        for (size_t index{0}; index < (0x0C00U + (section * 0x100U)); ++index)
+        {
+            HexDataVector data(DEFAULT_HEX_RECORD_DATA_SIZE);
+            for (auto& dataItem : data)
+            {
+                seed = (seed * 1103515245U) + 12345U;
+                dataItem = static_cast<HexDataType>(seed >> 16);
+            }
+            contents += HexRecord::makeDataRecord(static_cast<HexDataAddressType>(index * data.size()), data).getRecord() + "\n";
+        }
+    }
+
+    for (uint16_t section{3}; section < 300; ++section)
+    {
+        contents += HexRecord::makeExtendedLinearAddressRecord(section).getRecord() + "\n";
+        contents += HexRecord::makeDataRecord(section, HexDataVector{static_cast<HexDataType>(section)}).getRecord() + "\n";
+    }
+    contents += HexRecord::makeStartLinearAddressRecord(0x00200000).getRecord() + "\n";
+    contents += HexRecord::makeEndOfFileRecord().getRecord() + "\n";
+
+    // Output of the parallel saving is identical to the loaded contents
+    HexFile file{};
+    ASSERT_TRUE(file.load(contents.data(), contents.size()));
+    std::stringstream sequentialOutput{};
+    ASSERT_TRUE(file.save(sequentialOutput));
+    ASSERT_EQ(sequentialOutput.str(), contents);
+
+    for (size_t threadCount : {0, 2, 3, 8})
+    {
+        file.setThreadCount(threadCount);
+        std::stringstream parallelOutput{};
+        ASSERT_TRUE(file.save(parallelOutput));
+        ASSERT_EQ(parallelOutput.str(), contents);
+    }
+
+    // Line separator is used by the worker threads
+    file.setLineSeparator("\r\n");
+    file.setThreadCount(1);
+    HexMemorySink sequentialSink{};
+    ASSERT_TRUE(file.save(sequentialSink));
+    file.setThreadCount(3);
+    HexMemorySink parallelSink{};
+    ASSERT_TRUE(file.save(parallelSink));
+    ASSERT_EQ(parallelSink.getData(), sequentialSink.getData());
+    ASSERT_EQ(parallelSink.getData().size(), contents.size() + std::count(contents.begin(), contents.end(), '\n'));
+
+    // Records re-chunked by the worker threads
+    file.setLineSeparator();
+    file.setRecordDataSize(40);
+    file.setRecordAlignment(32);
+    file.setThreadCount(1);
+    HexMemorySink sequentialLayoutSink{};
+    ASSERT_TRUE(file.save(sequentialLayoutSink));
+    file.setThreadCount(3);
+    HexMemorySink parallelLayoutSink{};
+    ASSERT_TRUE(file.save(parallelLayoutSink));
+    ASSERT_EQ(parallelLayoutSink.getData(), sequentialLayoutSink.getData());
+    file.setRecordDataSize();
+    file.setRecordAlignment();
+
+    // Empty file
+    HexFile emptyFile{};
+    emptyFile.setThreadCount(4);
+    std::stringstream emptyOutput{};
+    ASSERT_TRUE(emptyFile.save(emptyOutput));
+    ASSERT_EQ(emptyOutput.str(), "");
+
+    // Blocks too large for a single record are reported by the worker threads
+    // after writing the records preceding them
+    auto& errorSection{file.getSection(299)};
+    HexDataVector errorData(0x200, 0xAA);
+    errorSection.clearData();
+    errorSection.setDefaultDataSize(0x200);
+    ASSERT_EQ(errorSection.setData(0x0000, errorData, errorData.size(), 0), errorData.size());
+    file.setThreadCount(1);
+    HexMemorySink sequentialErrorSink{};
+    ASSERT_THROW(file.save(sequentialErrorSink), std::out_of_range);
+    ASSERT_GT(sequentialErrorSink.getData().size(), 0);
+    for (size_t threadCount : {2, 3})
+    {
+        file.setThreadCount(threadCount);
+        HexMemorySink parallelErrorSink{};
+        ASSERT_THROW(file.save(parallelErrorSink), std::out_of_range);
+        ASSERT_EQ(parallelErrorSink.getData(), sequentialErrorSink.getData());
+    }
+
+    // File is closed when saving it throws, so the lowest free descriptor is the same
+    auto probe{std::tmpfile()};
+    ASSERT_NE(probe, nullptr);
+    const auto freeDescriptor{fileno(probe)};
+    std::fclose(probe);
+    ASSERT_THROW(file.save(std::string(TEST_HEX_FILE_ASSET_PATH) + "/parallel_error_out.hex"), std::out_of_range);
+    probe = std::tmpfile();
+    ASSERT_NE(probe, nullptr);
+    ASSERT_EQ(fileno(probe), freeDescriptor);
+    std::fclose(probe);
+}
+
+void HexFileTest::performSaveSinkTests()
+{
+    SCOPED_TRACE(__func__);
+
+    ASSERT_TRUE(file->load(std::string(TEST_HEX_FILE_ASSET_PATH) + "/sample1.hex"));
+    std::stringstream streamOutput{};
+    ASSERT_TRUE(file->save(streamOutput));
+
+    // Memory sink produces the same output as the stream
+    HexMemorySink memorySink{};
+    ASSERT_TRUE(file->save(memorySink));
+    ASSERT_EQ(memorySink.getData(), streamOutput.str());
+
+    // Saving and the following lookups do not reference the sections
+    ASSERT_EQ(file->getReferencedSectionCount(), 0);
+    for (const auto& range : file->getAddressMap())
+        ASSERT_EQ(file->findSection(range.first), file->findSection(range.first + range.second - 1));
+    ASSERT_EQ(file->getReferencedSectionCount(), 0);
+
+    // Small stream buffer produces the same output
+    std::stringstream smallOutput{};
+    HexStreamSink smallSink{smallOutput, 16};
+    ASSERT_TRUE(file->save(smallSink));
+    ASSERT_EQ(smallSink.getPendingSize(), 0);
+    ASSERT_EQ(smallOutput.str(), streamOutput.str());
+
+    // Carriage return and line feed separated lines
+    std::string expected;
+    for (auto character : streamOutput.str())
+    {
+        if (character == HEX_RECORD_LINE_SEPARATOR)
+            expected += "\r\n";
+        else
+            expected += character;
+    }
+
+    file->setLineSeparator("\r\n");
+    memorySink.clear();
+    ASSERT_TRUE(file->save(memorySink));
+    ASSERT_EQ(memorySink.getData(), expected);
+
+    // Saved file with separators loads back to the same file
+    auto fileName{std::string(TEST_HEX_FILE_ASSET_PATH) + "/sample1_crlf_out.hex"};
+    ASSERT_TRUE(file->save(fileName));
+    std::ifstream stream{fileName, std::ios_base::in | std::ios_base::binary};
+    std::string contents{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+    ASSERT_EQ(contents, expected);
+
+    HexFile file1{};
+    ASSERT_TRUE(file1.load(fileName));
+    std::stringstream reloadedOutput{};
+    ASSERT_TRUE(file1.save(reloadedOutput));
+    ASSERT_EQ(reloadedOutput.str(), streamOutput.str());
+
+    // Saving to a file, which can not be opened, fails
+    ASSERT_FALSE(file->save(std::string(TEST_HEX_FILE_ASSET_PATH) + "/missing/sample1_out.hex"));
+}
+
+void HexFileTest::performSaveRecordLayoutTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Data of the records of every line
+    auto getLines{[](const std::string& contents)
+    {
+        std::vector<std::string> lines;
+        std::istringstream stream{contents};
+        for (std::string line; std::getline(stream, line);)
+            lines.push_back(line);
+
+        return lines;
+    }};
+
+    ASSERT_TRUE(file->load(std::string(TEST_HEX_FILE_ASSET_PATH) + "/sample1.hex"));
+    HexMemorySink blockSink{};
+    ASSERT_TRUE(file->save(blockSink));
+
+    for (HexDataSizeType recordDataSize : {2, 32, 64, 255})
+    {
+        for (HexDataSizeType recordAlignment : {0, 1, 16, 64})
+        {
+            file->setRecordDataSize(recordDataSize);
+            file->setRecordAlignment(recordAlignment);
+            HexMemorySink sink{};
+            ASSERT_TRUE(file->save(sink));
+
+            // Records respect the data size and the alignment
+            for (const auto& line : getLines(sink.getData()))
+            {
+                HexRecord record{line};
+                if (record.getRecordType() != HexRecordType::RECORD_DATA)
+                    continue;
+
+                ASSERT_LE(record.getDataSize(), recordDataSize);
+                if (recordAlignment > 1)
+                {
+                    ASSERT_LE((record.getAddress() % recordAlignment) + record.getDataSize(), recordAlignment);
+                }
+            }
+
+            // Saved file loads back to the same data
+            HexFile file1{};
+            ASSERT_TRUE(file1.load(sink.getData().data(), sink.getData().size()));
+            HexMemorySink reloadedSink{};
+            ASSERT_TRUE(file1.save(reloadedSink));
+            ASSERT_EQ(reloadedSink.getData(), blockSink.getData());
+        }
+    }
+
+    // Larger records make the file smaller, the sections are not modified
+    file->setRecordDataSize(64);
+    file->setRecordAlignment(0);
+    HexMemorySink largeSink{};
+    ASSERT_TRUE(file->save(largeSink));
+    ASSERT_LT(largeSink.getData().size(), blockSink.getData().size());
+
+    file->setRecordDataSize();
+    HexMemorySink defaultSink{};
+    ASSERT_TRUE(file->save(defaultSink));
+    ASSERT_EQ(defaultSink.getData(), blockSink.getData());
+}
+
+void HexFileTest::performSaveCacheTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Saves the file without the cache
+    auto saveUncached{[](HexFile& file)
+    {
+        HexFile uncached{file};
+        uncached.setSaveCache(false);
+        HexMemorySink sink{};
+        EXPECT_TRUE(uncached.save(sink));
+        return sink.releaseData();
+    }};
+
+    ASSERT_TRUE(file->load(std::string(TEST_HEX_FILE_ASSET_PATH) + "/sample2.hex"));
+    ASSERT_GT(file->getSize(), 1);
+    auto expected{saveUncached(*file)};
+
+    file->setSaveCache(true);
+    ASSERT_EQ(file->getSaveCacheSize(), 0);
+
+    for (size_t threadCount : {1, 4})
+    {
+        file->setThreadCount(threadCount);
+
+        // First save fills the cache, the second one reuses it
+        HexMemorySink sink1{};
+        ASSERT_TRUE(file->save(sink1));
+        ASSERT_EQ(sink1.getData(), expected);
+        ASSERT_GT(file->getSaveCacheSize(), 0);
+        ASSERT_LE(file->getSaveCacheSize(), expected.size());
+
+        HexMemorySink sink2{};
+        ASSERT_TRUE(file->save(sink2));
+        ASSERT_EQ(sink2.getData(), expected);
+
+        // Modified section is encoded again
+        auto& section{file->getSection(0)};
+        auto address{section.getLowerAddress()};
+        section.setData(address, static_cast<HexDataType>(section.getData(address) ^ 0xFF));
+        expected = saveUncached(*file);
+        HexMemorySink sink3{};
+        ASSERT_TRUE(file->save(sink3));
+        ASSERT_EQ(sink3.getData(), expected);
+    }
+
+    // Data written through a reference is encoded again by the following saves
+    HexFile referencedFile{};
+    referencedFile.setSaveCache(true);
+    HexDataType data[]{0x01, 0x02, 0x03, 0x04};
+    ASSERT_EQ(referencedFile.setData(0x0000, data, 4), 4);
+    auto& reference{referencedFile[0x0000]};
+    HexMemorySink referenceSink1{};
+    ASSERT_TRUE(referencedFile.save(referenceSink1));
+    reference = 0x55;
+    auto referenceExpected{saveUncached(referencedFile)};
+    HexMemorySink referenceSink2{};
+    ASSERT_TRUE(referencedFile.save(referenceSink2));
+    ASSERT_EQ(referenceSink2.getData(), referenceExpected);
+    ASSERT_NE(referenceSink2.getData(), referenceSink1.getData());
+
+    // Changes of the layout clear the cache
+    file->setRecordDataSize(32);
+    ASSERT_EQ(file->getSaveCacheSize(), 0);
+    expected = saveUncached(*file);
+    HexMemorySink layoutSink{};
+    ASSERT_TRUE(file->save(layoutSink));
+    ASSERT_EQ(layoutSink.getData(), expected);
+
+    file->setLineSeparator("\r\n");
+    ASSERT_EQ(file->getSaveCacheSize(), 0);
+    expected = saveUncached(*file);
+    HexMemorySink separatorSink{};
+    ASSERT_TRUE(file->save(separatorSink));
+    ASSERT_EQ(separatorSink.getData(), expected);
+
+    // Removed sections are dropped from the cache
+    auto cacheSize{file->getSaveCacheSize()};
+    file->removeSection(0);
+    HexMemorySink removedSink{};
+    ASSERT_TRUE(file->save(removedSink));
+    ASSERT_EQ(removedSink.getData(), saveUncached(*file));
+    ASSERT_LT(file->getSaveCacheSize(), cacheSize);
+
+    // Cache is cleared on request and when disabled
+    file->clearSaveCache();
+    ASSERT_EQ(file->getSaveCacheSize(), 0);
+    HexMemorySink clearedSink{};
+    ASSERT_TRUE(file->save(clearedSink));
+    ASSERT_EQ(clearedSink.getData(), removedSink.getData());
+    ASSERT_GT(file->getSaveCacheSize(), 0);
+    file->setSaveCache(false);
+    ASSERT_EQ(file->getSaveCacheSize(), 0);
+}
+
+void HexFileTest::performPageStorageTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Block storage with the compact layout is the reference
+    ASSERT_TRUE(file->load(std::string(TEST_HEX_FILE_ASSET_PATH) + "/sample2.hex"));
+    for (size_t index{0}; index < file->getSize(); ++index)
+        file->getSection(index).compact();
+
+    HexMemorySink expected{};
+    ASSERT_TRUE(file->save(expected));
+
+    for (size_t threadCount : {1, 4})
+    {
+        HexFile pageFile{};
+        pageFile.setThreadCount(threadCount);
+        pageFile.setSectionStorageType(HexSectionStorageType::STORAGE_PAGE);
+        ASSERT_TRUE(pageFile.load(std::string(TEST_HEX_FILE_ASSET_PATH) + "/sample2.hex"));
+        ASSERT_EQ(pageFile.getSize(), file->getSize());
+        for (size_t index{0}; index < pageFile.getSize(); ++index)
+        {
+            ASSERT_EQ(pageFile.getSection(index).getStorageType(), HexSectionStorageType::STORAGE_PAGE);
+            if (file->getSection(index).hasData())
+            {
+                ASSERT_EQ(pageFile.getSection(index).getDataMap(), file->getSection(index).getDataMap());
+            }
+        }
+
+        HexMemorySink sink{};
+        ASSERT_TRUE(pageFile.save(sink));
+        ASSERT_EQ(sink.getData(), expected.getData());
+    }
+}
+
+void HexFileTest::performAllocatorTests()
+{
+    SCOPED_TRACE(__func__);
+
+    ASSERT_TRUE(file->load(std::string(TEST_HEX_FILE_ASSET_PATH) + "/sample2.hex"));
+    HexMemorySink expected{};
+    ASSERT_TRUE(file->save(expected));
+
+    for (size_t threadCount : {1, 4})
+    {
+        // Sections of the file loaded to the arena use the arena
+        std::pmr::monotonic_buffer_resource arena{};
+        HexFile arenaFile{&arena};
+        ASSERT_EQ(arenaFile.get_allocator().resource(), &arena);
+        arenaFile.setThreadCount(threadCount);
+        ASSERT_TRUE(arenaFile.load(std::string(TEST_HEX_FILE_ASSET_PATH) + "/sample2.hex"));
+        ASSERT_EQ(arenaFile.getSize(), file->getSize());
+        for (size_t index{0}; index < arenaFile.getSize(); ++index)
+            ASSERT_EQ(arenaFile.getSection(index).get_allocator().resource(), &arena);
+
+        HexMemorySink sink{};
+        ASSERT_TRUE(arenaFile.save(sink));
+        ASSERT_EQ(sink.getData(), expected.getData());
+
+        // Copies of the file do not depend on the arena
+        HexFile copy{arenaFile};
+        ASSERT_NE(copy.get_allocator().resource(), &arena);
+        ASSERT_NE(copy.getSection(0).get_allocator().resource(), &arena);
+        arenaFile.clearSections();
+        arena.release();
+
+        HexMemorySink copySink{};
+        ASSERT_TRUE(copy.save(copySink));
+        ASSERT_EQ(copySink.getData(), expected.getData());
+    }
+}
+
+void HexFileTest::performValidateTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Valid files, streams and memory
+    for (const auto& sample : {"sample1.hex", "sample2.hex"})
+    {
+        auto fileName{std::string(TEST_HEX_FILE_ASSET_PATH) + "/" + sample};
+        std::ifstream input{fileName};
+        std::string contents{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+        std::stringstream stream{contents};
+
+        HexDiagnostics diagnostics{};
+        ASSERT_TRUE(HexFile::validate(fileName, diagnostics));
+        ASSERT_TRUE(HexFile::validate(stream, diagnostics));
+        ASSERT_TRUE(HexFile::validate(contents.data(), contents.size(), diagnostics));
+        ASSERT_FALSE(diagnostics.hasErrors());
+    }
+
+    // Missing file
+    HexDiagnostics diagnostics{};
+    ASSERT_FALSE(HexFile::validate(std::string(TEST_HEX_FILE_ASSET_PATH) + "/missing_sample.hex", diagnostics));
+    ASSERT_FALSE(diagnostics.hasErrors());
+
+    // Errors are reported with line numbers and offsets
+    std::string contents{":04000000D8BCDA7816\r\n:xyz\n\n:06700000505D6C94AFA588\n:0200000100FF\n:00000001FF"};
+    const HexErrorVector expectedErrors{
+        {2, 21, HexErrorType::ERROR_INVALID_RECORD},
+        {4, 27, HexErrorType::ERROR_CHECKSUM_MISMATCH},
+        {5, 51, HexErrorType::ERROR_INVALID_RECORD}
+    };
+
+    auto fileName{std::string(TEST_HEX_FILE_ASSET_PATH) + "/invalid_validate_sample.hex"};
+    std::ofstream{fileName} << contents;
+    std::stringstream stream{contents};
+
+    for (size_t index{0}; index < 3; ++index)
+    {
+        diagnostics.clear();
+        switch (index)
+        {
+            case 0:
+                ASSERT_FALSE(HexFile::validate(fileName, diagnostics));
+                break;
+
+            case 1:
+                ASSERT_FALSE(HexFile::validate(stream, diagnostics));
+                break;
+
+            default:
+                ASSERT_FALSE(HexFile::validate(contents.data(), contents.size(), diagnostics));
+                break;
+        }
+
+        ASSERT_EQ(diagnostics.getErrorCount(), expectedErrors.size());
+        ASSERT_EQ(diagnostics.getErrors().size(), expectedErrors.size());
+        for (size_t errorIndex{0}; errorIndex < expectedErrors.size(); ++errorIndex)
+        {
+            ASSERT_EQ(diagnostics.getErrors().at(errorIndex).line, expectedErrors.at(errorIndex).line);
+            ASSERT_EQ(diagnostics.getErrors().at(errorIndex).offset, expectedErrors.at(errorIndex).offset);
+            ASSERT_EQ(diagnostics.getErrors().at(errorIndex).errorType, expectedErrors.at(errorIndex).errorType);
+        }
+    }
+
+    // Validation stops after the first errors
+    HexDiagnostics firstError{1};
+    ASSERT_FALSE(HexFile::validate(contents.data(), contents.size(), firstError));
+    ASSERT_EQ(firstError.getErrorCount(), 1);
+    ASSERT_EQ(firstError.getErrors().at(0).line, 2);
+
+    // Nothing is loaded
+    ASSERT_EQ(file->getSize(), 0);
+}
+
+void HexFileTest::performDiagnosticsTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Compare the errors
+    auto compareErrors{[](const HexErrorVector& errors, const HexErrorVector& expectedErrors)
+    {
+        ASSERT_EQ(errors.size(), expectedErrors.size());
+        for (size_t index{0}; index < expectedErrors.size(); ++index)
+        {
+            ASSERT_EQ(errors.at(index).line, expectedErrors.at(index).line);
+            ASSERT_EQ(errors.at(index).offset, expectedErrors.at(index).offset);
+            ASSERT_EQ(errors.at(index).errorType, expectedErrors.at(index).errorType);
+        }
+    }};
+
+    // Errors are collected instead of thrown
+    std::string contents{":020000040000FA\r\n:xyz\n\n:06700000505D6C94AFA588\n:020000040000FA\n:04000000D8BCDA7816\n:00000001FF"};
+    const HexErrorVector expectedErrors{
+        {2, 17, HexErrorType::ERROR_INVALID_RECORD},
+        {4, 23, HexErrorType::ERROR_CHECKSUM_MISMATCH},
+        {5, 47, HexErrorType::ERROR_REJECTED_RECORD}
+    };
+
+    auto diagnostics{std::make_shared<HexDiagnostics>()};
+    file->setDiagnostics(diagnostics);
+    ASSERT_EQ(file->getDiagnostics(), diagnostics);
+    ASSERT_TRUE(file->getThrowOnInvalidRecord());
+    ASSERT_TRUE(file->getThrowOnChecksumMismatch());
+    ASSERT_FALSE(file->load(contents.data(), contents.size()));
+    compareErrors(diagnostics->getErrors(), expectedErrors);
+    ASSERT_EQ(file->getLineNumber(), 7);
+    ASSERT_EQ(file->getLineOffset(), contents.size() - 11);
+    ASSERT_EQ(file->getData(0x0003), 0x78);
+
+    // Stream and file
+    auto fileName{std::string(TEST_HEX_FILE_ASSET_PATH) + "/diagnostics_sample.hex"};
+    std::ofstream{fileName} << contents;
+    std::stringstream stream{contents};
+    for (auto useStream : {true, false})
+    {
+        file->clearSections();
+        diagnostics->clear();
+        ASSERT_FALSE(useStream ? file->load(stream) : file->load(fileName));
+        compareErrors(diagnostics->getErrors(), expectedErrors);
+        ASSERT_EQ(file->getLineNumber(), 7);
+    }
+
+    // Incremental parser
+    file->clearSections();
+    diagnostics->clear();
+    HexParser parser{*file};
+    for (size_t offset{0}; offset < contents.size(); offset += 5)
+        parser.feed(contents.data() + offset, std::min(static_cast<size_t>(5), contents.size() - offset));
+    ASSERT_TRUE(parser.finish());
+    compareErrors(diagnostics->getErrors(), expectedErrors);
+    ASSERT_EQ(file->getLineNumber(), 7);
+
+    // Single lines
+    file->clearSections();
+    diagnostics->clear();
+    file->resetLinePosition();
+    ASSERT_FALSE(file->loadLine(":xyz"));
+    ASSERT_TRUE(file->loadLine(":020000040000FA"));
+    ASSERT_FALSE(file->loadLine(":020000040000FA"));
+    compareErrors(diagnostics->getErrors(), {
+        {1, 0, HexErrorType::ERROR_INVALID_RECORD},
+        {3, 21, HexErrorType::ERROR_REJECTED_RECORD}
+    });
+
+    // Rejected records are ignored without diagnostics
+    file->clearSections();
+    file->setDiagnostics(nullptr);
+    ASSERT_EQ(file->getDiagnostics(), nullptr);
+    ASSERT_TRUE(file->loadLine(":020000040000FA"));
+    ASSERT_TRUE(file->loadLine(":020000040000FA"));
+    ASSERT_THROW(file->loadLine(":xyz"), std::runtime_error);
+
+    // Parallel loading reports the same errors as the sequential loading
+    std::string largeContents;
+    for (uint16_t section{0}; section < 48; ++section)
+    {
+        largeContents += HexRecord::makeExtendedLinearAddressRecord(section % 40).getRecord() + "\n";
+        for (size_t index{0}; index < 64; ++index)
+        {
+            HexDataVector data(DEFAULT_HEX_RECORD_DATA_SIZE, static_cast<HexDataType>(index));
+            auto record{HexRecord::makeDataRecord(static_cast<HexDataAddressType>(index * data.size()), data).getRecord()};
+            if (((section % 7) == 3) && (index == 10))
+                record.back() = ((record.back() == '0') ? '1' : '0');
+            if (((section % 11) == 5) && (index == 20))
+                record = ":xyz";
+            largeContents += record + "\n";
+        }
+    }
+    largeContents += HexRecord::makeEndOfFileRecord().getRecord();
+
+    HexFile sequentialFile{};
+    auto sequentialDiagnostics{std::make_shared<HexDiagnostics>(256)};
+    sequentialFile.setDiagnostics(sequentialDiagnostics);
+    ASSERT_FALSE(sequentialFile.load(largeContents.data(), largeContents.size()));
+    ASSERT_EQ(sequentialFile.getLineNumber(), (48 * 65) + 1);
+
+    HexDiagnostics validateDiagnostics{256};
+    ASSERT_FALSE(HexFile::validate(largeContents.data(), largeContents.size(), validateDiagnostics));
+    ASSERT_GT(validateDiagnostics.getErrorCount(), 0);
+    ASSERT_EQ(sequentialDiagnostics->getErrorCount(), validateDiagnostics.getErrorCount() + 8);
+
+    for (size_t threadCount : {2, 4})
+    {
+        SCOPED_TRACE(threadCount);
+
+        HexFile parallelFile{};
+        auto parallelDiagnostics{std::make_shared<HexDiagnostics>(256)};
+        parallelFile.setThreadCount(threadCount);
+        parallelFile.setDiagnostics(parallelDiagnostics);
+        ASSERT_FALSE(parallelFile.load(largeContents.data(), largeContents.size()));
+        ASSERT_EQ(parallelFile.getLineNumber(), sequentialFile.getLineNumber());
+        compareErrors(parallelDiagnostics->getErrors(), sequentialDiagnostics->getErrors());
+
+        std::stringstream sequentialOutput{};
+        std::stringstream parallelOutput{};
+        ASSERT_TRUE(sequentialFile.save(sequentialOutput));
+        ASSERT_TRUE(parallelFile.save(parallelOutput));
+        ASSERT_EQ(parallelOutput.str(), sequentialOutput.str());
+    }
+}
+
 void HexFileTest::performPropertiesTests()
 {
     SCOPED_TRACE(__func__);
@@ -746,6 +1590,40 @@ void HexFileTest::performPropertiesTests()
 
     file->setThrowOnChecksumMismatch(true);
     ASSERT_TRUE(file->getThrowOnChecksumMismatch());
+
+    ASSERT_EQ(file->getThreadCount(), 1);
+    file->setThreadCount(0);
+    ASSERT_EQ(file->getThreadCount(), 0);
+    file->setThreadCount(4);
+    ASSERT_EQ(file->getThreadCount(), 4);
+
+    ASSERT_EQ(file->getLineSeparator(), "\n");
+    file->setLineSeparator("\r\n");
+    ASSERT_EQ(file->getLineSeparator(), "\r\n");
+    ASSERT_THROW(file->setLineSeparator(""), std::invalid_argument);
+    ASSERT_EQ(file->getLineSeparator(), "\r\n");
+    file->setLineSeparator();
+    ASSERT_EQ(file->getLineSeparator(), "\n");
+
+    ASSERT_EQ(file->getRecordDataSize(), 0);
+    file->setRecordDataSize(32);
+    ASSERT_EQ(file->getRecordDataSize(), 32);
+    ASSERT_THROW(file->setRecordDataSize(MAXIMUM_HEX_RECORD_DATA_SIZE + 1), std::out_of_range);
+    ASSERT_EQ(file->getRecordDataSize(), 32);
+    file->setRecordDataSize();
+    ASSERT_EQ(file->getRecordDataSize(), 0);
+
+    ASSERT_EQ(file->getRecordAlignment(), 0);
+    file->setRecordAlignment(16);
+    ASSERT_EQ(file->getRecordAlignment(), 16);
+    file->setRecordAlignment();
+    ASSERT_EQ(file->getRecordAlignment(), 0);
+
+    ASSERT_FALSE(file->getSaveCache());
+    file->setSaveCache(true);
+    ASSERT_TRUE(file->getSaveCache());
+    file->setSaveCache(false);
+    ASSERT_FALSE(file->getSaveCache());
 }
 
 END_NAMESPACE_LIBIHEX
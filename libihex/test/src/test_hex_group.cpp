@@ -54,6 +54,12 @@ TEST_F(HexGroupTest, GetSetUnusedDataFillValueTests)
     performGetSetUnusedDataFillValueTests();
 }
 
+TEST_F(HexGroupTest, GetSetSectionStorageTypeTests)
+{
+    SCOPED_TRACE("GetSetSectionStorageTypeTests");
+    performGetSetSectionStorageTypeTests();
+}
+
 TEST_F(HexGroupTest, AddressMapTests)
 {
     SCOPED_TRACE("AddressMapTests");
@@ -162,4 +168,28 @@ TEST_F(HexGroupTest, StartLinearAddressTests)
     performStartLinearAddressTests();
 }
 
+TEST_F(HexGroupTest, AddressIndexTests)
+{
+    SCOPED_TRACE("AddressIndexTests");
+    performAddressIndexTests();
+}
+
+TEST_F(HexGroupTest, AddressRangeTests)
+{
+    SCOPED_TRACE("AddressRangeTests");
+    performAddressRangeTests();
+}
+
+TEST_F(HexGroupTest, SectionReferenceTests)
+{
+    SCOPED_TRACE("SectionReferenceTests");
+    performSectionReferenceTests();
+}
+
+TEST_F(HexGroupTest, DataReferenceTests)
+{
+    SCOPED_TRACE("DataReferenceTests");
+    performDataReferenceTests();
+}
+
 END_NAMESPACE_LIBIHEX
@@ -19,6 +19,7 @@
     SPDX-License-Identifier: GPL-3.0-or-later
 */
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <stdexcept>
 #include <string>
@@ -398,6 +399,46 @@ void HexGroupTest::performGetSetUnusedDataFillValueTests()
     ASSERT_EQ(group->getData(0x20001030), unusedDataFillValue2);
 }
 
+void HexGroupTest::performGetSetSectionStorageTypeTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Initial section
+    const HexRecord record1{":101000005CB6DB55241E0B0A84248F6E4AB90DD7BB"};
+    const HexRecord record2{":101020001913F8AB8FF77734D9230C64F629F267DC"};
+    HexSection section1{record1};
+    ASSERT_TRUE(section1.pushRecord(record2));
+    section1.convertToExtendedLinearAddressSection(0x2000);
+
+    // Existing sections are converted
+    ASSERT_EQ(group->getSectionStorageType(), HexSectionStorageType::STORAGE_BLOCKS);
+    ASSERT_EQ(group->pushSection(section1), 0);
+    ASSERT_EQ(group->getSection(0).getStorageType(), HexSectionStorageType::STORAGE_BLOCKS);
+    group->setSectionStorageType(HexSectionStorageType::STORAGE_PAGE);
+    ASSERT_EQ(group->getSectionStorageType(), HexSectionStorageType::STORAGE_PAGE);
+    ASSERT_EQ(group->getSection(0).getStorageType(), HexSectionStorageType::STORAGE_PAGE);
+    ASSERT_THROW(group->setSectionStorageType(static_cast<HexSectionStorageType>(2)), std::invalid_argument);
+
+    // Pushed and created sections use the storage type
+    ASSERT_EQ(group->pushSection(endOfFileSection), 1);
+    ASSERT_EQ(group->getSection(1).getStorageType(), HexSectionStorageType::STORAGE_PAGE);
+    auto index{group->createSection(HexAddressEnumType::ADDRESS_I32HEX, 0x30000000)};
+    ASSERT_EQ(group->getSection(index).getStorageType(), HexSectionStorageType::STORAGE_PAGE);
+
+    // Data is kept
+    ASSERT_EQ(group->getData(0x20001000), 0x5C);
+    ASSERT_EQ(group->getData(0x2000102F), 0x67);
+    group->setData(0x30000010, 0xA5);
+    ASSERT_EQ(group->getData(0x30000010), 0xA5);
+
+    group->setSectionStorageType();
+    for (size_t sectionIndex{0}; sectionIndex < group->getSize(); sectionIndex++)
+        ASSERT_EQ(group->getSection(sectionIndex).getStorageType(), HexSectionStorageType::STORAGE_BLOCKS);
+
+    ASSERT_EQ(group->getData(0x20001000), 0x5C);
+    ASSERT_EQ(group->getData(0x30000010), 0xA5);
+}
+
 void HexGroupTest::performAddressMapTests()
 {
     SCOPED_TRACE(__func__);
@@ -3128,4 +3169,241 @@ void HexGroupTest::performStartLinearAddressTests()
     ASSERT_EQ(group->getSection(0).getRecord(0).getRecord(), startSegmentAddressSection.getRecord(0).getRecord());
 }
 
+void HexGroupTest::performAddressIndexTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Sections pushed out of the address order
+    group->clearSections();
+    for (uint16_t linearAddress : {0x0005, 0x0001, 0x0009, 0x0003, 0x0007})
+        ASSERT_NE(group->pushSection(HexSection::makeExtendedLinearAddressSection(linearAddress)), std::string::npos);
+    ASSERT_EQ(group->pushSection(endOfFileSection), 5);
+    ASSERT_EQ(group->pushSection(startLinearAddressSection), 5);
+
+    // Lookup in the address order, in the reverse order and outside of the sections
+    for (size_t index{0}; index < 5; ++index)
+    {
+        const auto& sect{static_cast<const HexGroup&>(*group).getSection(index)};
+        const auto min{sect.getMinAbsoluteAddress()};
+        const auto max{sect.getMaxAbsoluteAddress()};
+        ASSERT_EQ(group->findSection(min), index);
+        ASSERT_EQ(group->findSection(min + 0x8000), index);
+        ASSERT_EQ(group->findSection(max), index);
+        ASSERT_EQ(group->findSection(max + 1), std::string::npos);
+        ASSERT_EQ(group->findSection(min - 1), std::string::npos);
+    }
+
+    for (HexAddressType address{0x0009FFFF}; address >= 0x00010000; address -= 0x8000)
+        ASSERT_EQ(group->findSection(address), group->findSection(address & 0xFFFF0000));
+    ASSERT_EQ(group->findSection(0), std::string::npos);
+    ASSERT_EQ(group->findSection(0xFFFFFFFF), std::string::npos);
+
+    // Data through the index
+    group->setData(0x00030010, 0x11);
+    group->setData(0x00070010, 0x22);
+    ASSERT_EQ(group->getData(0x00030010), 0x11);
+    ASSERT_EQ((*group)[0x00070010], 0x22);
+    ASSERT_EQ(static_cast<const HexGroup&>(*group)[0x00030010], 0x11);
+    ASSERT_THROW((*group)[0x00050010], std::out_of_range);
+    group->clearData(0x00030010);
+    ASSERT_EQ(group->getData(0x00030010), group->getUnusedDataFillValue());
+
+    // Removing and pushing sections keeps the index up to date
+    const auto removed{group->findSection(0x00050000)};
+    ASSERT_NO_THROW(group->removeSection(removed));
+    ASSERT_EQ(group->findSection(0x00050000), std::string::npos);
+    ASSERT_EQ(group->findSection(0x00070010), 3);
+    ASSERT_EQ(group->createSection(0x00050000), 5);
+    ASSERT_EQ(group->findSection(0x00050000), 5);
+    ASSERT_EQ(group->findSection(0x00070010), 3);
+    ASSERT_EQ(group->getData(0x00070010), 0x22);
+
+    // Section address changed through the reference
+    ASSERT_TRUE(group->getSection(5).setExtendedLinearAddress(0x000B));
+    ASSERT_EQ(group->findSection(0x00050000), std::string::npos);
+    ASSERT_EQ(group->findSection(0x000B0000), 5);
+
+    // Copied and moved groups
+    HexGroup copy{*group};
+    ASSERT_EQ(copy.findSection(0x00070010), 3);
+    HexGroup moved{std::move(copy)};
+    ASSERT_EQ(moved.findSection(0x00070010), 3);
+    ASSERT_EQ(copy.findSection(0x00070010), std::string::npos);
+    copy = std::move(moved);
+    ASSERT_EQ(copy.findSection(0x000B0000), 5);
+    ASSERT_EQ(moved.findSection(0x000B0000), std::string::npos);
+
+    // Cleared sections
+    group->clearData();
+    ASSERT_EQ(group->findSection(0x00070010), std::string::npos);
+    ASSERT_EQ(group->getSize(), 2);
+
+    // Wrapped-around SECTION_EXTENDED_SEGMENT_ADDRESS section
+    group->clearSections();
+    ASSERT_EQ(group->pushSection(HexSection::makeExtendedSegmentAddressSection(0x1000)), 0);
+    ASSERT_EQ(group->pushSection(HexSection::makeExtendedSegmentAddressSection(0xF800)), 1);
+    ASSERT_EQ(group->findSection(0xF8000), 1);
+    ASSERT_EQ(group->findSection(0xFFFFF), 1);
+    ASSERT_EQ(group->findSection(0x00000), 1);
+    ASSERT_EQ(group->findSection(0x07FFF), 1);
+    ASSERT_EQ(group->findSection(0x08000), std::string::npos);
+    ASSERT_EQ(group->findSection(0x10000), 0);
+    ASSERT_NO_THROW(group->removeSection(0));
+    ASSERT_EQ(group->findSection(0x10000), std::string::npos);
+    ASSERT_EQ(group->findSection(0x00000), 0);
+}
+
+void HexGroupTest::performAddressRangeTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Group type follows the pushed and removed sections
+    group->clearSections();
+    ASSERT_EQ(group->getGroupType(), HexAddressEnumType::ADDRESS_I8HEX);
+    ASSERT_EQ(group->pushSection(endOfFileSection), 0);
+    ASSERT_EQ(group->getGroupType(), HexAddressEnumType::ADDRESS_I8HEX);
+    ASSERT_EQ(group->pushSection(startLinearAddressSection), 0);
+    ASSERT_EQ(group->getGroupType(), HexAddressEnumType::ADDRESS_I32HEX);
+    ASSERT_NO_THROW(group->removeSection(0));
+    ASSERT_EQ(group->getGroupType(), HexAddressEnumType::ADDRESS_I8HEX);
+    ASSERT_EQ(group->pushSection(extendedSegmentAddressSection1), 0);
+    ASSERT_EQ(group->getGroupType(), HexAddressEnumType::ADDRESS_I16HEX);
+    group->clearData();
+    ASSERT_EQ(group->getGroupType(), HexAddressEnumType::ADDRESS_I8HEX);
+
+    // Section type changed through the reference
+    ASSERT_EQ(group->createSection(0), 0);
+    ASSERT_EQ(group->getGroupType(), HexAddressEnumType::ADDRESS_I8HEX);
+    group->getSection(0).convertToExtendedLinearAddressSection(0x0004);
+    ASSERT_EQ(group->getGroupType(), HexAddressEnumType::ADDRESS_I32HEX);
+    ASSERT_EQ(group->findSection(0x00040000), 0);
+
+    // Address map, previous and next sections of the sections with gaps
+    group->clearSections();
+    for (uint16_t linearAddress : {0x0008, 0x0002, 0x0006, 0x0004})
+        ASSERT_NE(group->pushSection(HexSection::makeExtendedLinearAddressSection(linearAddress)), std::string::npos);
+    ASSERT_EQ(group->pushSection(endOfFileSection), 4);
+
+    const HexAddressMap expected{{0x00020000, 0x10000}, {0x00040000, 0x10000}, {0x00060000, 0x10000}, {0x00080000, 0x10000}};
+    ASSERT_EQ(group->getAddressMap(), expected);
+    ASSERT_EQ(group->findPreviousSection(0x00020000), std::string::npos);
+    ASSERT_EQ(group->findPreviousSection(0x00030000), 1);
+    ASSERT_EQ(group->findPreviousSection(0x00068000), 3);
+    ASSERT_EQ(group->findPreviousSection(0xFFFFFFFF), 0);
+    ASSERT_EQ(group->findNextSection(0), 1);
+    ASSERT_EQ(group->findNextSection(0x00058000), 2);
+    ASSERT_EQ(group->findNextSection(0x00060000), 0);
+    ASSERT_EQ(group->findNextSection(0x00080000), std::string::npos);
+
+    // Data across the adjacent sections and the gaps between the sections
+    HexDataType data[0x10002];
+    for (size_t index{0}; index < sizeof(data); ++index)
+        data[index] = static_cast<HexDataType>(index);
+    ASSERT_EQ(group->setData(0x0004FFFF, &data[0], 0x10002), 0x10002);
+    ASSERT_EQ(group->getSize(), 6);
+    ASSERT_EQ(group->findSection(0x00050000), 4);
+
+    HexDataType result[0x20002]{};
+    ASSERT_EQ(group->getData(0x0004FFFF, &result[0], 0x10002), 0x10002);
+    ASSERT_TRUE(std::equal(&data[0], &data[0x10002], &result[0]));
+    ASSERT_EQ(group->getData(0x0003FFFF, &result[0], 0x20002), 0x20001);
+    ASSERT_EQ(result[0], group->getUnusedDataFillValue());
+    ASSERT_EQ(result[0x10001], data[1]);
+
+    HexDataVector vector{};
+    ASSERT_EQ(group->getData(0x00060000, vector, 2), 2);
+    ASSERT_EQ(vector, (HexDataVector{data[0x10001], group->getUnusedDataFillValue()}));
+
+    ASSERT_EQ(group->clearData(0x00040000, 0x20000), 0x20000);
+    ASSERT_EQ(group->getData(0x0004FFFF), group->getUnusedDataFillValue());
+    ASSERT_EQ(group->getData(0x00060000), data[0x10001]);
+    ASSERT_EQ(group->getDataMap(), (HexAddressMap{{0x00060000, 1}}));
+}
+
+void HexGroupTest::performSectionReferenceTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Address changed through the reference held across lookups
+    group->clearSections();
+    ASSERT_EQ(group->pushSection(HexSection::makeExtendedLinearAddressSection(0x0001)), 0);
+    group->setData(0x00010000, 0x11);
+    auto& sect{group->getSection(0)};
+    ASSERT_EQ(group->getData(0x00010000), 0x11);
+    ASSERT_TRUE(sect.setExtendedLinearAddress(0x0002));
+
+    // Section referenced again is tracked once
+    ASSERT_EQ(&group->getSection(0), &sect);
+    ASSERT_EQ(group->getReferencedSectionCount(), 1);
+
+    // Const lookups see the current address without modifying the group
+    const HexGroup& constGroup{*group};
+    ASSERT_EQ(constGroup.getData(0x00020000), 0x11);
+    ASSERT_EQ(constGroup.getData(0x00010000), constGroup.getUnusedDataFillValue());
+    ASSERT_EQ(constGroup.findSection(0x00010000), std::string::npos);
+    ASSERT_EQ(constGroup.findSection(0x00020000), 0);
+    ASSERT_EQ(constGroup[0x00020000], 0x11);
+    ASSERT_EQ(constGroup.getAddressMap(), HexSection::makeExtendedLinearAddressSection(0x0002).getAddressMap());
+
+    // Modifications through the group use the current address too
+    ASSERT_EQ(group->fillData(0x00020001, 2, 0x22), 2);
+    ASSERT_EQ(group->getData(0x00020002), 0x22);
+    ASSERT_EQ(group->clearData(0x00020002, 1), 1);
+    ASSERT_EQ(group->getData(0x00020002), group->getUnusedDataFillValue());
+    HexDataType data[]{0x33, 0x44};
+    ASSERT_EQ(group->setData(0x00020003, data, 2), 2);
+    ASSERT_EQ(group->getData(0x00020004), 0x44);
+    ASSERT_EQ(group->getSize(), 1);
+
+    // Reference is still checked after the lookups rebuilt the address ranges
+    ASSERT_TRUE(sect.setExtendedLinearAddress(0x0003));
+    ASSERT_EQ(group->findSection(0x00030000), 0);
+    ASSERT_EQ(group->getData(0x00030004), 0x44);
+
+    // Const access does not reference the sections
+    group->clearSections();
+    ASSERT_EQ(group->getReferencedSectionCount(), 0);
+    ASSERT_EQ(group->pushSection(HexSection::makeExtendedLinearAddressSection(0x0001)), 0);
+    ASSERT_EQ(constGroup.getSection(0).getExtendedLinearAddress(), 0x0001);
+    ASSERT_EQ(group->getReferencedSectionCount(), 0);
+
+    // Section type changed through the reference
+    group->clearSections();
+    ASSERT_EQ(group->pushSection(HexSection{}), 0);
+    auto& dataSect{group->getSection(0)};
+    ASSERT_EQ(group->getGroupType(), HexAddressEnumType::ADDRESS_I8HEX);
+    dataSect.convertToExtendedSegmentAddressSection(0x0100);
+    ASSERT_EQ(group->getGroupType(), HexAddressEnumType::ADDRESS_I16HEX);
+    ASSERT_FALSE(group->canPushSection(HexSection::makeExtendedLinearAddressSection(0x0001)));
+    ASSERT_TRUE(group->canPushSection(HexSection::makeExtendedSegmentAddressSection(0x2000)));
+    ASSERT_EQ(group->findSection(0x00001000), 0);
+    ASSERT_EQ(group->findSection(0x00000FFF), std::string::npos);
+
+    // Copies of the group are up to date
+    HexGroup copy{*group};
+    ASSERT_EQ(copy.getGroupType(), HexAddressEnumType::ADDRESS_I16HEX);
+    ASSERT_EQ(copy.findSection(0x00001000), 0);
+}
+
+void HexGroupTest::performDataReferenceTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Copy made after the data is referenced does not see the writes through the reference
+    group->clearSections();
+    group->setData(0x0100, 0x11);
+    auto& reference{(*group)[0x0100]};
+    HexGroup copy{*group};
+    reference = 0x22;
+    ASSERT_EQ(group->getData(0x0100), 0x22);
+    ASSERT_EQ(copy.getData(0x0100), 0x11);
+
+    // Assigned group does not see them either
+    HexGroup assigned{};
+    assigned = *group;
+    reference = 0x33;
+    ASSERT_EQ(group->getData(0x0100), 0x33);
+    ASSERT_EQ(assigned.getData(0x0100), 0x22);
+}
+
 END_NAMESPACE_LIBIHEX
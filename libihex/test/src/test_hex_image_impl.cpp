@@ -0,0 +1,229 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ihex/hex_file.hpp>
+#include <ihex/hex_image.hpp>
+#include <ihex/hex_record.hpp>
+#include <ihex_test/test_hex_file_assets.hpp>
+#include <ihex_test/test_hex_image_impl.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+HexImageTest::HexImageTest()
+{
+
+}
+
+HexImageTest::~HexImageTest()
+{
+
+}
+
+void HexImageTest::SetUp()
+{
+    Test::SetUp();
+}
+
+void HexImageTest::TearDown()
+{
+    Test::TearDown();
+}
+
+void HexImageTest::performVectorTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Image matches the loaded file
+    for (const auto& sample : {"sample1.hex", "sample2.hex"})
+    {
+        auto fileName{std::string(TEST_HEX_FILE_ASSET_PATH) + "/" + sample};
+        HexFile file{};
+        ASSERT_TRUE(file.load(fileName));
+
+        HexImage image{0x5A};
+        ASSERT_TRUE(image.visit(fileName));
+        ASSERT_FALSE(image.isExternal());
+        ASSERT_GT(image.getSize(), 0);
+        ASSERT_EQ(image.getFillValue(), 0x5A);
+        ASSERT_EQ(image.getDiscardedSize(), 0);
+
+        // Image covers the written ranges
+        const auto& writtenMap{image.getWrittenMap()};
+        ASSERT_GT(writtenMap.size(), 0);
+        ASSERT_EQ(writtenMap.begin()->first, image.getBaseAddress());
+        ASSERT_EQ(writtenMap.rbegin()->first + writtenMap.rbegin()->second, image.getBaseAddress() + image.getSize());
+
+        auto range{writtenMap.begin()};
+        for (HexDataSizeType offset{0}; offset < image.getSize(); ++offset)
+        {
+            auto address{static_cast<HexAddressType>(image.getBaseAddress() + offset)};
+            if (address >= (range->first + range->second))
+                ++range;
+
+            if (address >= range->first)
+                ASSERT_EQ(image.getData()[offset], file.getData(address));
+            else
+                ASSERT_EQ(image.getData()[offset], 0x5A);
+        }
+
+        // Released vector holds the image, which is cleared
+        const HexDataVector imageData(image.getData(), image.getData() + image.getSize());
+        ASSERT_EQ(image.releaseDataVector(), imageData);
+        ASSERT_EQ(image.getSize(), 0);
+        ASSERT_EQ(image.getWrittenMap().size(), 0);
+    }
+
+    // Image grows in both directions
+    const HexDataVector data{0x01, 0x02, 0x03, 0x04};
+    HexImage image{};
+    ASSERT_EQ(image.getSize(), 0);
+    ASSERT_TRUE(image.visitLine(HexRecord::makeDataRecord(0x1000, data).getRecord()));
+    ASSERT_EQ(image.getBaseAddress(), 0x1000);
+    ASSERT_EQ(image.getSize(), 4);
+    ASSERT_TRUE(image.visitLine(HexRecord::makeDataRecord(0x0FF0, data).getRecord()));
+    ASSERT_EQ(image.getBaseAddress(), 0x0FF0);
+    ASSERT_EQ(image.getSize(), 0x14);
+    ASSERT_TRUE(image.visitLine(HexRecord::makeDataRecord(0x1010, data).getRecord()));
+    ASSERT_EQ(image.getSize(), 0x24);
+    ASSERT_EQ(HexDataVector(image.getData(), image.getData() + image.getSize()), (HexDataVector{
+        0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x01, 0x02, 0x03, 0x04}));
+
+    // Overwritten data
+    ASSERT_TRUE(image.visitLine(HexRecord::makeDataRecord(0x1002, HexDataVector{0xAA}).getRecord()));
+    ASSERT_EQ(image.getData()[0x12], 0xAA);
+    ASSERT_EQ(image.getSize(), 0x24);
+
+    // Data at the end of the address space
+    ASSERT_TRUE(image.visitLine(HexRecord::makeExtendedLinearAddressRecord(0xFFFF).getRecord()));
+    image.clear();
+    ASSERT_EQ(image.getSize(), 0);
+    ASSERT_EQ(image.getWrittenMap().size(), 0);
+    ASSERT_TRUE(image.visitLine(HexRecord::makeExtendedLinearAddressRecord(0xFFFF).getRecord()));
+    ASSERT_TRUE(image.visitLine(HexRecord::makeDataRecord(0xFFFC, data).getRecord()));
+    ASSERT_EQ(image.getBaseAddress(), 0xFFFFFFFC);
+    ASSERT_EQ(image.getSize(), 4);
+    ASSERT_EQ(image.getWrittenMap(), (HexAddressMap{{0xFFFFFFFC, 4}}));
+
+    // Image grows in front of the base address for the descending addresses
+    image.clear();
+    HexDataVector descendingData{};
+    for (HexAddressType address{0x4000}; address > 0x2000; address -= 0x10)
+    {
+        ASSERT_TRUE(image.visitLine(HexRecord::makeDataRecord(static_cast<HexDataAddressType>(address - 4), data).getRecord()));
+        ASSERT_EQ(image.getBaseAddress(), address - 4);
+        ASSERT_EQ(image.getSize(), 0x4000 - (address - 4));
+        ASSERT_EQ(image.getData()[0], 0x01);
+        ASSERT_EQ(image.getData()[4], 0xFF);
+    }
+
+    for (size_t index{0}; index < 0x200; ++index)
+    {
+        descendingData.insert(descendingData.end(), data.begin(), data.end());
+        descendingData.insert(descendingData.end(), 12, 0xFF);
+    }
+    descendingData.resize(descendingData.size() - 12);
+    ASSERT_EQ(image.getWrittenMap().size(), 0x200);
+    ASSERT_EQ(image.releaseDataVector(), descendingData);
+}
+
+void HexImageTest::performBufferTests()
+{
+    SCOPED_TRACE(__func__);
+
+    const HexDataVector data{0x01, 0x02, 0x03, 0x04};
+    std::vector<HexDataType> buffer(0x10, 0x00);
+    HexImage image{0x2000, buffer.data(), buffer.size(), 0xEE};
+    ASSERT_TRUE(image.isExternal());
+    ASSERT_EQ(image.getBaseAddress(), 0x2000);
+    ASSERT_EQ(image.getData(), buffer.data());
+    ASSERT_EQ(image.getSize(), 0x10);
+    ASSERT_EQ(image.releaseDataVector().size(), 0);
+    ASSERT_EQ(buffer, std::vector<HexDataType>(0x10, 0xEE));
+
+    // Data inside the buffer
+    ASSERT_TRUE(image.visitLine(HexRecord::makeDataRecord(0x2004, data).getRecord()));
+    ASSERT_EQ(buffer.at(0x4), 0x01);
+    ASSERT_EQ(buffer.at(0x7), 0x04);
+    ASSERT_EQ(image.getDiscardedSize(), 0);
+
+    // Data partially outside of the buffer is clipped
+    ASSERT_TRUE(image.visitLine(HexRecord::makeDataRecord(0x1FFE, data).getRecord()));
+    ASSERT_TRUE(image.visitLine(HexRecord::makeDataRecord(0x200E, data).getRecord()));
+    ASSERT_EQ(buffer.at(0x0), 0x03);
+    ASSERT_EQ(buffer.at(0x1), 0x04);
+    ASSERT_EQ(buffer.at(0xE), 0x01);
+    ASSERT_EQ(buffer.at(0xF), 0x02);
+    ASSERT_EQ(image.getDiscardedSize(), 4);
+
+    // Data outside of the buffer is discarded
+    ASSERT_TRUE(image.visitLine(HexRecord::makeDataRecord(0x3000, data).getRecord()));
+    ASSERT_TRUE(image.visitLine(HexRecord::makeDataRecord(0x0000, data).getRecord()));
+    ASSERT_EQ(image.getDiscardedSize(), 12);
+    ASSERT_EQ(image.getWrittenMap(), (HexAddressMap{{0x2000, 2}, {0x2004, 4}, {0x200E, 2}}));
+    ASSERT_EQ(buffer.at(0x2), 0xEE);
+
+    // Clear refills the buffer
+    image.clear();
+    ASSERT_EQ(buffer, std::vector<HexDataType>(0x10, 0xEE));
+    ASSERT_EQ(image.getWrittenMap().size(), 0);
+    ASSERT_EQ(image.getDiscardedSize(), 0);
+    ASSERT_EQ(image.getBaseAddress(), 0x2000);
+}
+
+void HexImageTest::performWrittenMapTests()
+{
+    SCOPED_TRACE(__func__);
+
+    HexImage image{};
+    auto write{[&image](HexDataAddressType address, HexDataSizeType size)
+    {
+        return image.visitLine(HexRecord::makeDataRecord(address, HexDataVector(size, 0x00)).getRecord());
+    }};
+
+    // Separate ranges
+    ASSERT_TRUE(write(0x0100, 0x10));
+    ASSERT_TRUE(write(0x0200, 0x10));
+    ASSERT_EQ(image.getWrittenMap(), (HexAddressMap{{0x0100, 0x10}, {0x0200, 0x10}}));
+
+    // Adjacent ranges are merged
+    ASSERT_TRUE(write(0x0110, 0x10));
+    ASSERT_TRUE(write(0x00F0, 0x10));
+    ASSERT_EQ(image.getWrittenMap(), (HexAddressMap{{0x00F0, 0x30}, {0x0200, 0x10}}));
+
+    // Overlapping ranges are merged
+    ASSERT_TRUE(write(0x0118, 0x10));
+    ASSERT_TRUE(write(0x0104, 0x04));
+    ASSERT_EQ(image.getWrittenMap(), (HexAddressMap{{0x00F0, 0x38}, {0x0200, 0x10}}));
+
+    // Range spanning several ranges
+    ASSERT_TRUE(write(0x0000, 0xFF));
+    ASSERT_TRUE(write(0x00FF, 0xFF));
+    ASSERT_TRUE(write(0x01FE, 0x20));
+    ASSERT_EQ(image.getWrittenMap(), (HexAddressMap{{0x0000, 0x21E}}));
+    ASSERT_EQ(image.getSize(), 0x21E);
+}
+
+END_NAMESPACE_LIBIHEX
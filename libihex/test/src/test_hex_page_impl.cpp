@@ -0,0 +1,150 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <memory>
+#include <gtest/gtest.h>
+#include <ihex/hex_page.hpp>
+#include <ihex_test/test_hex_page_impl.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+HexPageTest::HexPageTest()
+{
+
+}
+
+HexPageTest::~HexPageTest()
+{
+
+}
+
+void HexPageTest::SetUp()
+{
+    Test::SetUp();
+    page = std::make_shared<HexPage>();
+}
+
+void HexPageTest::TearDown()
+{
+    page.reset();
+    Test::TearDown();
+}
+
+void HexPageTest::performDataTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Empty page is not allocated
+    ASSERT_FALSE(page->hasData());
+    ASSERT_FALSE(page->hasData(0));
+    ASSERT_EQ(page->getDataSize(), 0);
+    ASSERT_EQ(page->getData(), nullptr);
+
+    HexDataType data[4]{};
+    page->getData(0x1000, data, 4, 0xFF);
+    for (auto value : data)
+        ASSERT_EQ(value, 0xFF);
+
+    page->clearData(0x1000, 4);
+    ASSERT_EQ(page->getDataSize(), 0);
+
+    // Set data across the bitmap words
+    const HexDataType source[]{0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    page->setData(0x003E, source, 6);
+    ASSERT_TRUE(page->hasData());
+    ASSERT_NE(page->getData(), nullptr);
+    ASSERT_EQ(page->getDataSize(), 6);
+    ASSERT_FALSE(page->hasData(0x003D));
+    ASSERT_TRUE(page->hasData(0x003E));
+    ASSERT_TRUE(page->hasData(0x0043));
+    ASSERT_FALSE(page->hasData(0x0044));
+    ASSERT_EQ(page->getData()[0x0040], 0x03);
+
+    // Overwriting the data does not change the data size
+    page->setData(0x0040, source, 2);
+    ASSERT_EQ(page->getDataSize(), 6);
+    ASSERT_EQ(page->getData()[0x0041], 0x02);
+
+    // Unused addresses are filled with the unused data fill value
+    HexDataType result[8]{};
+    page->getData(0x003C, result, 8, 0xAA);
+    const HexDataType expected[]{0xAA, 0xAA, 0x01, 0x02, 0x01, 0x02, 0x05, 0x06};
+    for (size_t index{0}; index < 8; ++index)
+        ASSERT_EQ(result[index], expected[index]);
+
+    // Fill data up to the end of the page
+    page->fillData(0xFFF0, 0x10, 0x55);
+    ASSERT_EQ(page->getDataSize(), 0x16);
+    ASSERT_TRUE(page->hasData(0xFFFF));
+    ASSERT_EQ(page->getData()[0xFFFF], 0x55);
+
+    // Clear part of the data
+    page->clearData(0x0041, 0x100);
+    ASSERT_EQ(page->getDataSize(), 0x13);
+    ASSERT_TRUE(page->hasData(0x0040));
+    ASSERT_FALSE(page->hasData(0x0041));
+
+    // Copy shares nothing with the original
+    HexPage copy{*page};
+    copy.clearData(0x0000, HEX_PAGE_SIZE);
+    ASSERT_FALSE(copy.hasData());
+    ASSERT_EQ(page->getDataSize(), 0x13);
+
+    // Clear all data and release the buffers
+    page->clearData();
+    ASSERT_FALSE(page->hasData());
+    ASSERT_EQ(page->getDataSize(), 0);
+    ASSERT_EQ(page->getData(), nullptr);
+}
+
+void HexPageTest::performFindTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Empty page
+    ASSERT_EQ(page->findData(0), HEX_PAGE_SIZE);
+    ASSERT_EQ(page->findGap(0x1234), 0x1234);
+    ASSERT_EQ(page->findGap(HEX_PAGE_SIZE), HEX_PAGE_SIZE);
+    ASSERT_EQ(page->findLastData(), HEX_PAGE_SIZE);
+
+    // Runs of data
+    page->fillData(0x0010, 0x0100, 0x00);
+    page->fillData(0x8000, 0x0001, 0x00);
+    page->fillData(0xFF00, 0x0100, 0x00);
+
+    ASSERT_EQ(page->findData(0), 0x0010);
+    ASSERT_EQ(page->findData(0x0010), 0x0010);
+    ASSERT_EQ(page->findData(0x0110), 0x8000);
+    ASSERT_EQ(page->findData(0x8001), 0xFF00);
+    ASSERT_EQ(page->findData(HEX_PAGE_SIZE), HEX_PAGE_SIZE);
+
+    ASSERT_EQ(page->findGap(0), 0);
+    ASSERT_EQ(page->findGap(0x0010), 0x0110);
+    ASSERT_EQ(page->findGap(0x8000), 0x8001);
+    ASSERT_EQ(page->findGap(0xFF00), HEX_PAGE_SIZE);
+
+    ASSERT_EQ(page->findLastData(), 0xFFFF);
+    page->clearData(0xFF00, 0x0100);
+    ASSERT_EQ(page->findLastData(), 0x8000);
+    ASSERT_EQ(page->findData(0x8001), HEX_PAGE_SIZE);
+}
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,170 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <gtest/gtest.h>
+#include <ihex/hex_file.hpp>
+#include <ihex/hex_parser.hpp>
+#include <ihex_test/test_hex_file_assets.hpp>
+#include <ihex_test/test_hex_parser_impl.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+HexParserTest::HexParserTest()
+{
+
+}
+
+HexParserTest::~HexParserTest()
+{
+
+}
+
+void HexParserTest::SetUp()
+{
+    Test::SetUp();
+    file = std::make_shared<HexFile>();
+    parser = std::make_shared<HexParser>(*file);
+}
+
+void HexParserTest::TearDown()
+{
+    parser.reset();
+    file.reset();
+    Test::TearDown();
+}
+
+void HexParserTest::performFeedTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Any chunk size produces the same file as loading the whole input
+    for (const auto& sample : {"sample1.hex", "sample2.hex"})
+    {
+        std::ifstream input{std::string(TEST_HEX_FILE_ASSET_PATH) + "/" + sample};
+        std::string contents{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+
+        HexFile expectedFile{};
+        ASSERT_TRUE(expectedFile.load(contents.data(), contents.size()));
+        std::stringstream expectedOutput{};
+        ASSERT_TRUE(expectedFile.save(expectedOutput));
+
+        for (size_t chunkSize : {1, 2, 7, 43, 64, 4096, 0x100000})
+        {
+            HexFile chunkedFile{};
+            HexParser chunkedParser{chunkedFile};
+
+            for (size_t offset{0}; offset < contents.size(); offset += chunkSize)
+                ASSERT_TRUE(chunkedParser.feed(contents.data() + offset, std::min(chunkSize, contents.size() - offset)));
+            ASSERT_TRUE(chunkedParser.finish());
+            ASSERT_EQ(chunkedParser.getPendingSize(), 0);
+
+            std::stringstream chunkedOutput{};
+            ASSERT_TRUE(chunkedFile.save(chunkedOutput));
+            ASSERT_EQ(chunkedOutput.str(), expectedOutput.str());
+        }
+    }
+
+    // Record split between chunks
+    std::string contents{":04000000D8BCDA7816\r\n:06700000505D6C94AFA589\r\n"};
+    ASSERT_TRUE(parser->feed(contents.data(), 10));
+    ASSERT_EQ(file->getSize(), 0);
+    ASSERT_EQ(parser->getPendingSize(), 10);
+    ASSERT_TRUE(parser->feed(contents.data() + 10, 20));
+    ASSERT_EQ(file->getSize(), 1);
+    ASSERT_EQ(file->getData(0x0003), 0x78);
+    ASSERT_EQ(parser->getPendingSize(), 9);
+    ASSERT_TRUE(parser->feed(contents.data() + 30, contents.size() - 30));
+    ASSERT_EQ(parser->getPendingSize(), 0);
+    ASSERT_EQ(file->getSize(), 1);
+    ASSERT_EQ(file->getSection(0).getSize(), 2);
+    ASSERT_EQ(file->getData(0x7005), 0xA5);
+
+    // Empty chunk
+    ASSERT_TRUE(parser->feed(nullptr, 0));
+    ASSERT_EQ(file->getSection(0).getSize(), 2);
+}
+
+void HexParserTest::performFinishTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Last line without line separator
+    std::string contents{":04000000D8BCDA7816\n:00000001FF"};
+    ASSERT_TRUE(parser->feed(contents.data(), contents.size()));
+    ASSERT_EQ(file->getSize(), 1);
+    ASSERT_EQ(parser->getPendingSize(), 11);
+    ASSERT_TRUE(parser->finish());
+    ASSERT_EQ(parser->getPendingSize(), 0);
+    ASSERT_EQ(file->getSize(), 2);
+    ASSERT_EQ(file->getSection(1).getSectionType(), HexSectionType::SECTION_END_OF_FILE);
+
+    // Finish without incomplete line
+    ASSERT_TRUE(parser->finish());
+    ASSERT_EQ(file->getSize(), 2);
+
+    // Reset discards the incomplete line
+    file->clearSections();
+    ASSERT_TRUE(parser->feed(contents.data(), contents.size()));
+    parser->reset();
+    ASSERT_EQ(parser->getPendingSize(), 0);
+    ASSERT_TRUE(parser->finish());
+    ASSERT_EQ(file->getSize(), 1);
+    ASSERT_EQ(file->getSection(0).getSectionType(), HexSectionType::SECTION_DATA);
+}
+
+void HexParserTest::performInvalidTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Exceptions are propagated
+    std::string invalidRecord{":xyz\n"};
+    ASSERT_THROW(parser->feed(invalidRecord.data(), invalidRecord.size()), std::runtime_error);
+
+    std::string checksumMismatch{":06700000505D6C94AFA588"};
+    ASSERT_TRUE(parser->feed(checksumMismatch.data(), checksumMismatch.size()));
+    ASSERT_THROW(parser->finish(), std::logic_error);
+
+    // Invalid lines fail without exceptions
+    file->setThrowOnInvalidRecord(false);
+    file->setThrowOnChecksumMismatch(false);
+    std::string contents{":04000000D8BCDA7816\n:xyz\n:06700000505D6C94AFA588\n:00000001FF\n"};
+    ASSERT_FALSE(parser->feed(contents.data(), contents.size()));
+    ASSERT_EQ(file->getSize(), 2);
+    ASSERT_EQ(file->getData(0x0003), 0x78);
+
+    // Overlong line is truncated, trailing characters are ignored
+    file->clearSections();
+    std::string longLine{":04000000D8BCDA7816" + std::string(0x10000, '0') + "\n"};
+    for (size_t offset{0}; offset < longLine.size(); offset += 100)
+    {
+        ASSERT_TRUE(parser->feed(longLine.data() + offset, std::min(static_cast<size_t>(100), longLine.size() - offset)));
+        ASSERT_LE(parser->getPendingSize(), 4 * (MAXIMUM_HEX_RECORD_DATA_SIZE + 6));
+    }
+    ASSERT_EQ(file->getSize(), 1);
+    ASSERT_EQ(file->getData(0x0003), 0x78);
+}
+
+END_NAMESPACE_LIBIHEX
@@ -102,6 +102,18 @@ TEST_F(HexRecordTest, SetRecordTests)
     performSetRecordTests();
 }
 
+TEST_F(HexRecordTest, EncodeTests)
+{
+    SCOPED_TRACE("EncodeTests");
+    performEncodeTests();
+}
+
+TEST_F(HexRecordTest, RecordViewTests)
+{
+    SCOPED_TRACE("RecordViewTests");
+    performRecordViewTests();
+}
+
 TEST_F(HexRecordTest, ChecksumTests)
 {
     SCOPED_TRACE("ChecksumTests");
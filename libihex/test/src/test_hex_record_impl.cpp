@@ -20,6 +20,8 @@
 */
 
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <gtest/gtest.h>
 #include <ihex_test/test_hex_record_impl.hpp>
 
@@ -531,6 +533,18 @@ void HexRecordTest::performGetSetRecordPropertiesTests()
 
     ASSERT_EQ(record->getRecord(), std::string(":1018290020222426282A2C2E30323436383A3C3EBF"));
 
+    // Resized data keeps the existing data and adds default data
+    ASSERT_TRUE(record->setDataSize(8));
+    ASSERT_THROW((*record)[8], std::out_of_range);
+    ASSERT_TRUE(record->setDataSize(16));
+    for (uint8_t index{0}; index < 16; ++index)
+        ASSERT_EQ((*record)[index], ((index < 8) ? data[index] : DEFAULT_HEX_RECORD_DATA_VALUE));
+
+    for (uint8_t index{0}; index < 16; ++index)
+        record->setData(index, data[index]);
+
+    ASSERT_EQ(record->getRecord(), std::string(":1018290020222426282A2C2E30323436383A3C3EBF"));
+
     // RECORD_END_OF_FILE
     ASSERT_TRUE(record->setDataSize(0));
     ASSERT_EQ(record->getDataSize(), 0);
@@ -672,6 +686,11 @@ void HexRecordTest::performGetDataPropertiesTests()
     ASSERT_NO_THROW(value = record->getData(record->getDataSize() + 1));
     ASSERT_EQ(value, DEFAULT_HEX_RECORD_DATA_VALUE);
 
+    // RECORD_DATA (pointer)
+    ASSERT_NE(record->getData(), nullptr);
+    for (HexDataSizeType index{0}; index < record->getDataSize(); ++index)
+        ASSERT_EQ(record->getData()[index], dataInArray[index]);
+
     // RECORD_DATA (HexDataArray)
     for (size_t index{0}; index < dataInArray.size(); ++index)
         dataInArray[index] = (0x5A + (0x11 * index));
@@ -1103,6 +1122,126 @@ void HexRecordTest::performSetRecordTests()
     ASSERT_FALSE(record->setRecord(":02000000"));
     ASSERT_FALSE(record->setRecord(":020000001A"));
     ASSERT_FALSE(record->setRecord(":020000001A2B"));
+
+    // Invalid hex digits
+    ASSERT_FALSE(record->setRecord(":xyz"));
+    ASSERT_FALSE(record->setRecord(":0G000001FF"));
+    ASSERT_FALSE(record->setRecord(":00000G01FF"));
+    ASSERT_FALSE(record->setRecord(":000000G1FF"));
+    ASSERT_FALSE(record->setRecord(":00000001FG"));
+    ASSERT_FALSE(record->setRecord(":025C6D027Z8F26"));
+    ASSERT_FALSE(record->setRecord(":025C6D02 E8F26"));
+
+    // Lowercase hex digits
+    ASSERT_TRUE(record->setRecord(":025c6d027e8f26"));
+    ASSERT_EQ(record->getAddress(), 0x5C6D);
+    ASSERT_EQ(record->getExtendedSegmentAddress(), 0x7E8F);
+    ASSERT_TRUE(record->isValidChecksum());
+
+    // Trailing characters are ignored
+    ASSERT_TRUE(record->setRecord(":00000001FF\r"));
+    ASSERT_EQ(record->getRecordType(), HexRecordType::RECORD_END_OF_FILE);
+    ASSERT_TRUE(record->isValidChecksum());
+
+    // std::string and std::string_view records
+    std::string stringRecord{":0400000528394A5BF1"};
+    ASSERT_TRUE(record->setRecord(stringRecord));
+    ASSERT_EQ(record->getStartLinearAddressExtendedInstructionPointer(), 0x28394A5B);
+
+    std::string_view viewRecord{":025C6D027E8F26:00000001FF"};
+    ASSERT_TRUE(record->setRecord(viewRecord.substr(0, 15)));
+    ASSERT_EQ(record->getRecordType(), HexRecordType::RECORD_EXTENDED_SEGMENT_ADDRESS);
+    ASSERT_TRUE(record->setRecord(viewRecord.substr(15)));
+    ASSERT_EQ(record->getRecordType(), HexRecordType::RECORD_END_OF_FILE);
+    ASSERT_FALSE(record->setRecord(viewRecord.substr(0, 14)));
+
+    // Pointer and size records (the size limits parsing)
+    const char* bufferRecord{":103A4B0000020406080A0C0E10121416181A1C1E7B"};
+    ASSERT_TRUE(record->setRecord(bufferRecord, 43));
+    ASSERT_EQ(record->getDataSize(), 16);
+    ASSERT_EQ(record->getData(15), 0x1E);
+    ASSERT_TRUE(record->isValidChecksum());
+    ASSERT_FALSE(record->setRecord(bufferRecord, 42));
+    ASSERT_FALSE(record->setRecord(bufferRecord, 0));
+}
+
+void HexRecordTest::performEncodeTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Encode a record to a caller buffer (no separator or terminator is written)
+    HexRecord record1{":10112200000102030405060708090A0B0C0D0E0F45"};
+    char buffer1[MAXIMUM_HEX_RECORD_LENGTH + 1]{};
+    ASSERT_EQ(record1.getRecordLength(), 43);
+    ASSERT_EQ(record1.encode(buffer1), 43);
+    ASSERT_EQ(std::string(buffer1), record1.getRecord());
+
+    // Encode records to the end of a reused string
+    std::string buffer2{"prefix"};
+    HexRecord record2{HexRecordType::RECORD_END_OF_FILE};
+    ASSERT_EQ(record2.encode(buffer2), 11);
+    ASSERT_EQ(buffer2, std::string("prefix:00000001FF"));
+    ASSERT_EQ(record1.encode(buffer2), 43);
+    ASSERT_EQ(buffer2, std::string("prefix:00000001FF:10112200000102030405060708090A0B0C0D0E0F45"));
+
+    // Maximum sized record fills the maximum length exactly
+    HexDataVector data(MAXIMUM_HEX_RECORD_DATA_SIZE, 0xA5);
+    HexRecord record3{};
+    record3.prepareDataRecord(0xFFFF, data);
+    std::string buffer3;
+    ASSERT_EQ(record3.getRecordLength(), MAXIMUM_HEX_RECORD_LENGTH);
+    ASSERT_EQ(record3.encode(buffer3), MAXIMUM_HEX_RECORD_LENGTH);
+    ASSERT_EQ(buffer3.size(), MAXIMUM_HEX_RECORD_LENGTH);
+    ASSERT_EQ(buffer3.substr(0, 9), std::string(":FFFFFF00"));
+
+    // Encoded record parses back to the same record
+    HexRecord record4{};
+    ASSERT_TRUE(record4.setRecord(buffer3));
+    ASSERT_EQ(record4.getRecord(), buffer3);
+    ASSERT_EQ(record4.getDataSize(), MAXIMUM_HEX_RECORD_DATA_SIZE);
+    ASSERT_EQ(record4.getData(MAXIMUM_HEX_RECORD_DATA_SIZE - 1), 0xA5);
+}
+
+void HexRecordTest::performRecordViewTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Default view is an end of file record
+    HexRecordView view1{};
+    ASSERT_EQ(view1.getAddress(), 0);
+    ASSERT_EQ(view1.getRecordType(), HexRecordType::RECORD_END_OF_FILE);
+    ASSERT_EQ(view1.getDataSize(), 0);
+    ASSERT_EQ(view1.getChecksum(), 0xFF);
+    ASSERT_EQ(view1.getRecordLength(), 11);
+    ASSERT_EQ(view1.getRecord(), std::string(":00000001FF"));
+    ASSERT_THROW(view1.getData(0), std::out_of_range);
+
+    // View of the external data with a calculated checksum
+    const HexDataType data[]{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
+    HexRecordView view2{0x1122, HexRecordType::RECORD_DATA, data, sizeof(data)};
+    ASSERT_EQ(view2.getAddress(), 0x1122);
+    ASSERT_EQ(view2.getData(), data);
+    ASSERT_EQ(view2.getData(15), 0x0F);
+    ASSERT_THROW(view2.getData(16), std::out_of_range);
+    ASSERT_EQ(view2.getDataSize(), 16);
+    ASSERT_EQ(view2.getChecksum(), 0x45);
+    ASSERT_EQ(view2.getRecord(), std::string(":10112200000102030405060708090A0B0C0D0E0F45"));
+
+    // View of a record keeps its checksum and refers to its data
+    HexRecord record1{":10112200000102030405060708090A0B0C0D0E0F45"};
+    record1.setChecksum(0x12);
+    auto view3{record1.getView()};
+    ASSERT_EQ(view3.getChecksum(), 0x12);
+    ASSERT_EQ(view3.getRecord(), record1.getRecord());
+    ASSERT_EQ(view3.getData(1), record1.getData(1));
+
+    // Explicit checksum and data size limits
+    HexRecordView view4{0x0000, HexRecordType::RECORD_END_OF_FILE, nullptr, 0, 0xAB};
+    ASSERT_EQ(view4.getRecord(), std::string(":00000001AB"));
+
+    HexDataVector data2(MAXIMUM_HEX_RECORD_DATA_SIZE + 1, 0);
+    ASSERT_NO_THROW(HexRecordView(0x0000, HexRecordType::RECORD_DATA, data2.data(), MAXIMUM_HEX_RECORD_DATA_SIZE));
+    ASSERT_THROW(HexRecordView(0x0000, HexRecordType::RECORD_DATA, data2.data(), data2.size()), std::out_of_range);
 }
 
 void HexRecordTest::performChecksumTests()
@@ -186,4 +186,58 @@ TEST_F(HexSectionTest, CompactTests)
     performCompactTests();
 }
 
+TEST_F(HexSectionTest, RecordIteratorTests)
+{
+    SCOPED_TRACE("RecordIteratorTests");
+    performRecordIteratorTests();
+}
+
+TEST_F(HexSectionTest, RecordLayoutTests)
+{
+    SCOPED_TRACE("RecordLayoutTests");
+    performRecordLayoutTests();
+}
+
+TEST_F(HexSectionTest, RevisionTests)
+{
+    SCOPED_TRACE("RevisionTests");
+    performRevisionTests();
+}
+
+TEST_F(HexSectionTest, StorageTests)
+{
+    SCOPED_TRACE("StorageTests");
+    performStorageTests();
+}
+
+TEST_F(HexSectionTest, LookupTests)
+{
+    SCOPED_TRACE("LookupTests");
+    performLookupTests();
+}
+
+TEST_F(HexSectionTest, PushLayoutTests)
+{
+    SCOPED_TRACE("PushLayoutTests");
+    performPushLayoutTests();
+}
+
+TEST_F(HexSectionTest, AllocatorTests)
+{
+    SCOPED_TRACE("AllocatorTests");
+    performAllocatorTests();
+}
+
+TEST_F(HexSectionTest, CopyOnWriteTests)
+{
+    SCOPED_TRACE("CopyOnWriteTests");
+    performCopyOnWriteTests();
+}
+
+TEST_F(HexSectionTest, DataReferenceTests)
+{
+    SCOPED_TRACE("DataReferenceTests");
+    performDataReferenceTests();
+}
+
 END_NAMESPACE_LIBIHEX
@@ -19,7 +19,11 @@
     SPDX-License-Identifier: GPL-3.0-or-later
 */
 
+#include <functional>
+#include <memory_resource>
 #include <stdexcept>
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 #include <ihex/hex_record.hpp>
 #include <ihex/hex_section.hpp>
@@ -27,6 +31,47 @@
 
 BEGIN_NAMESPACE_LIBIHEX
 
+namespace
+{
+    /**
+     * @brief Memory resource counting the allocated bytes
+     *
+     */
+    class CountingResource : public std::pmr::memory_resource
+    {
+        public:
+            /**
+             * @brief Currently allocated bytes
+             *
+             */
+            size_t allocated{0};
+
+            /**
+             * @brief Number of allocations
+             *
+             */
+            size_t allocations{0};
+        protected:
+            void* do_allocate(size_t bytes, size_t alignment) override
+            {
+                allocated += bytes;
+                allocations++;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+            {
+                allocated -= bytes;
+                std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+            {
+                return (this == &other);
+            }
+    };
+}
+
 HexSectionTest::HexSectionTest()
 {
 
@@ -2988,4 +3033,643 @@ void HexSectionTest::performCompactTests()
     ASSERT_EQ(compareRecord.getRecord(), ":090060003044267CFFBE30AC7F69");
 }
 
+void HexSectionTest::performRecordIteratorTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Empty SECTION_DATA has no records
+    section->convertToDataSection();
+    ASSERT_TRUE(section->begin() == section->end());
+    ASSERT_TRUE(HexRecordIterator{} == HexRecordIterator{});
+
+    // SECTION_DATA yields every block once, matching getRecord()
+    section->setData(0x10, 0xAA);
+    section->fillData(0x20, 16, 0x55);
+    section->setData(0xFFF0, 0x11);
+
+    size_t index{0};
+    for (const auto& record : *section)
+    {
+        ASSERT_EQ(record.getRecord(), section->getRecord(index).getRecord());
+        ++index;
+    }
+    ASSERT_EQ(index, section->getSize());
+
+    auto it{section->begin()};
+    ASSERT_EQ(it->getAddress(), 0x10);
+    ASSERT_EQ(it->getRecordType(), HexRecordType::RECORD_DATA);
+    ASSERT_EQ(it->getDataSize(), 1);
+    auto previous{it++};
+    ASSERT_TRUE(previous == section->begin());
+    ASSERT_TRUE(previous != it);
+    ASSERT_EQ((*it).getAddress(), 0x20);
+    ASSERT_EQ(std::distance(section->begin(), section->end()), 3);
+
+    // SECTION_EXTENDED_LINEAR_ADDRESS yields the section record first
+    HexSection section1{":020000040001F9"};
+    section1.setData(0x0000, 0x01);
+    section1.setData(0x8000, 0x02);
+
+    index = 0;
+    for (const auto& record : section1)
+    {
+        ASSERT_EQ(record.getRecord(), section1.getRecord(index).getRecord());
+        ++index;
+    }
+    ASSERT_EQ(index, 3);
+    ASSERT_EQ(section1.begin()->getRecordType(), HexRecordType::RECORD_EXTENDED_LINEAR_ADDRESS);
+
+    // Single record sections
+    HexSection section2{":00000001FF"};
+    ASSERT_EQ(std::distance(section2.begin(), section2.end()), 1);
+    ASSERT_EQ(section2.begin()->getRecord(), ":00000001FF");
+
+    HexSection section3{":0400000500000000F7"};
+    ASSERT_EQ(std::distance(section3.begin(), section3.end()), 1);
+    ASSERT_EQ(section3.begin()->getRecord(), ":0400000500000000F7");
+
+    // Iterators of different sections are different
+    ASSERT_TRUE(section2.end() != section3.end());
+
+    // Oversized blocks can not be viewed as records
+    HexSection section4{};
+    section4.setDefaultDataSize(0x200);
+    section4.fillData(0x0000, 0x200, 0x00);
+    section4.compact();
+    ASSERT_EQ(section4.getSize(), 1);
+    ASSERT_THROW(section4.begin(), std::out_of_range);
+}
+
+void HexSectionTest::performRecordLayoutTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Collect the records of the iteration
+    auto getRecords{[](const HexSection& section, HexDataSizeType recordDataSize, HexDataSizeType recordAlignment)
+    {
+        std::vector<std::string> records;
+        for (auto it{section.begin(recordDataSize, recordAlignment)}; it != section.end(); ++it)
+            records.push_back(it->getRecord());
+
+        return records;
+    }};
+
+    // Contiguous blocks 0x0008-0x0047 and a separate block at 0x0100
+    section->convertToDataSection();
+    for (HexDataAddressType address{0x0008}; address < 0x0048; ++address)
+        section->setData(address, static_cast<HexDataType>(address));
+    section->setData(0x0100, 0xAA);
+    section->setData(0x0101, 0xBB);
+    ASSERT_EQ(section->getSize(), 5);
+
+    // Block layout is the same as begin()
+    auto records{getRecords(*section, 0, 32)};
+    ASSERT_EQ(records.size(), 5);
+    ASSERT_EQ(records.at(0), section->getRecord(0).getRecord());
+    ASSERT_EQ(records.at(4), section->getRecord(4).getRecord());
+
+    // Records of up to 32 bytes are gathered from the contiguous blocks
+    records = getRecords(*section, 32, 0);
+    ASSERT_EQ(records.size(), 3);
+    ASSERT_EQ(records.at(0).substr(0, 9), ":20000800");
+    ASSERT_EQ(records.at(1).substr(0, 9), ":20002800");
+    ASSERT_EQ(records.at(2), HexRecord::makeDataRecord(0x0100, HexDataVector{0xAA, 0xBB}).getRecord());
+
+    HexDataVector data(32);
+    for (HexDataSizeType index{0}; index < data.size(); ++index)
+        data[index] = static_cast<HexDataType>(0x08 + index);
+    ASSERT_EQ(records.at(0), HexRecord::makeDataRecord(0x0008, data).getRecord());
+
+    // Records do not cross the alignment boundaries
+    records = getRecords(*section, 32, 32);
+    ASSERT_EQ(records.size(), 4);
+    ASSERT_EQ(records.at(0).substr(0, 9), ":18000800");
+    ASSERT_EQ(records.at(1).substr(0, 9), ":20002000");
+    ASSERT_EQ(records.at(2).substr(0, 9), ":08004000");
+    ASSERT_EQ(records.at(3).substr(0, 9), ":02010000");
+
+    // Records smaller than blocks refer to the blocks
+    records = getRecords(*section, 5, 8);
+    ASSERT_EQ(records.size(), 17);
+    ASSERT_EQ(records.at(0).substr(0, 9), ":05000800");
+    ASSERT_EQ(records.at(1).substr(0, 9), ":03000D00");
+    ASSERT_EQ(records.at(2).substr(0, 9), ":05001000");
+
+    // Maximum record data size
+    records = getRecords(*section, MAXIMUM_HEX_RECORD_DATA_SIZE, 1);
+    ASSERT_EQ(records.size(), 2);
+    ASSERT_EQ(records.at(0).substr(0, 9), ":40000800");
+    ASSERT_THROW(section->begin(MAXIMUM_HEX_RECORD_DATA_SIZE + 1), std::out_of_range);
+
+    // Copied iterators refer to their own gathered data
+    auto it1{section->begin(32)};
+    auto it2{it1};
+    ++it1;
+    ASSERT_EQ(it2->getRecord(), getRecords(*section, 32, 0).at(0));
+    it2 = it1;
+    ++it1;
+    ASSERT_EQ(it2->getRecord(), getRecords(*section, 32, 0).at(1));
+    ASSERT_TRUE(it1 != it2);
+
+    // Section with the section record
+    HexSection section1{":020000040001F9"};
+    section1.fillData(0x0000, 0x40, 0x11);
+    records = getRecords(section1, 64, 0);
+    ASSERT_EQ(records.size(), 2);
+    ASSERT_EQ(records.at(0), ":020000040001F9");
+    ASSERT_EQ(records.at(1).substr(0, 9), ":40000000");
+}
+
+void HexSectionTest::performRevisionTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // New sections have unique revisions
+    HexSection section1{HexSectionType::SECTION_DATA};
+    HexSection section2{HexSectionType::SECTION_DATA};
+    ASSERT_NE(section1.getRevision(), section2.getRevision());
+
+    // Copies share the revision until modified
+    section1.setData(0x1000, 0x55);
+    HexSection section3{section1};
+    ASSERT_EQ(section3.getRevision(), section1.getRevision());
+    section2 = section1;
+    ASSERT_EQ(section2.getRevision(), section1.getRevision());
+
+    // Reading data does not change the revision
+    auto revision{section1.getRevision()};
+    const HexSection& constSection{section1};
+    ASSERT_EQ(constSection[0x1000], 0x55);
+    ASSERT_EQ(section1.getData(0x1000), 0x55);
+    ASSERT_TRUE(section1.hasData());
+    for (auto record{section1.begin()}; record != section1.end(); ++record)
+        ASSERT_EQ(record->getDataSize(), 1);
+
+    ASSERT_EQ(section1.getRevision(), revision);
+
+    // Every modification changes the revision
+    section1.setData(0x1001, 0x66);
+    ASSERT_NE(section1.getRevision(), revision);
+    ASSERT_EQ(section3.getRevision(), revision);
+
+    revision = section1.getRevision();
+    section1.fillData(0x2000, 4, 0xAA);
+    ASSERT_NE(section1.getRevision(), revision);
+
+    revision = section1.getRevision();
+    section1.clearData(0x2000);
+    ASSERT_NE(section1.getRevision(), revision);
+
+    revision = section1.getRevision();
+    section1.compact();
+    ASSERT_NE(section1.getRevision(), revision);
+
+    revision = section1.getRevision();
+    section1.setDefaultDataSize(32);
+    ASSERT_NE(section1.getRevision(), revision);
+
+    revision = section1.getRevision();
+    section1[0x1000] = 0x77;
+    ASSERT_NE(section1.getRevision(), revision);
+}
+
+void HexSectionTest::performStorageTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Same operations on both storage types
+    HexSection blocks{HexSectionType::SECTION_DATA};
+    HexSection page{HexSectionType::SECTION_DATA};
+    ASSERT_EQ(page.getStorageType(), HexSectionStorageType::STORAGE_BLOCKS);
+    page.setStorageType(HexSectionStorageType::STORAGE_PAGE);
+    ASSERT_EQ(page.getStorageType(), HexSectionStorageType::STORAGE_PAGE);
+    ASSERT_THROW(page.setStorageType(static_cast<HexSectionStorageType>(2)), std::invalid_argument);
+
+    HexDataVector data(0x50);
+    for (size_t index{0}; index < data.size(); ++index)
+        data.at(index) = static_cast<HexDataType>(index + 1);
+
+    for (auto* section : {&blocks, &page})
+    {
+        ASSERT_FALSE(section->hasData());
+        ASSERT_THROW(section->getLowerAddress(), std::out_of_range);
+        ASSERT_EQ(section->setData(0x1000, data.data(), 0x30), 0x30);
+        ASSERT_EQ(section->setData(0x1030, data, 0x20, 0x30), 0x20);
+        section->setData(0x2000, 0x11);
+        ASSERT_EQ(section->fillData(0x3000, 0x18, 0x22), 0x18);
+        ASSERT_EQ(section->clearData(0x3008, 0x08), 0x08);
+        section->clearData(0x1025);
+        (*section)[0x2000] = 0x33;
+        section->compact();
+    }
+
+    // Data, addresses and records are equal
+    ASSERT_EQ(page.getDataSize(), blocks.getDataSize());
+    ASSERT_EQ(page.getDataSize(), 0x50 - 1 + 1 + 0x10);
+    ASSERT_EQ(page.getLowerAddress(), blocks.getLowerAddress());
+    ASSERT_EQ(page.getUpperAddress(), blocks.getUpperAddress());
+    ASSERT_EQ(page.getDataMap(), blocks.getDataMap());
+    ASSERT_EQ(page.getSize(), blocks.getSize());
+    for (size_t index{0}; index < blocks.getSize(); ++index)
+        ASSERT_EQ(page.getRecord(index).getRecord(), blocks.getRecord(index).getRecord());
+
+    ASSERT_THROW(page.getRecord(page.getSize()), std::out_of_range);
+
+    for (HexDataAddressType address : {0x0000, 0x0FFF, 0x1000, 0x1024, 0x1025, 0x1026, 0x104F, 0x1050, 0x2000, 0x3007, 0x3008, 0x3010, 0x3017, 0xFFFF})
+    {
+        ASSERT_EQ(page.getData(address), blocks.getData(address));
+        ASSERT_EQ(page.findAddress(address), blocks.findAddress(address));
+        ASSERT_EQ(page.findPreviousRecord(address), blocks.findPreviousRecord(address));
+        ASSERT_EQ(page.findNextRecord(address), blocks.findNextRecord(address));
+    }
+
+    ASSERT_EQ(page[0x2000], 0x33);
+    ASSERT_THROW(page[0x2001], std::out_of_range);
+    const HexSection& constPage{page};
+    ASSERT_EQ(constPage[0x1000], 0x01);
+    ASSERT_THROW(constPage[0x3008], std::out_of_range);
+
+    HexDataType pageData[0x60]{};
+    HexDataType blocksData[0x60]{};
+    ASSERT_EQ(page.getData(0x0FF0, pageData, 0x60), 0x60);
+    ASSERT_EQ(blocks.getData(0x0FF0, blocksData, 0x60), 0x60);
+    HexDataVector pageVector{0x00};
+    HexDataVector blocksVector{0x00};
+    ASSERT_EQ(page.getData(0x0FF0, pageVector, 0x60, 1), 0x60);
+    ASSERT_EQ(blocks.getData(0x0FF0, blocksVector, 0x60, 1), 0x60);
+    ASSERT_EQ(pageVector, blocksVector);
+    for (size_t index{0}; index < 0x60; ++index)
+        ASSERT_EQ(pageData[index], blocksData[index]);
+
+    // Record iterators yield the same records
+    for (HexDataSizeType recordDataSize : {0, 7, 32})
+    {
+        auto pageRecord{page.begin(recordDataSize, 8)};
+        for (auto record{blocks.begin(recordDataSize, 8)}; record != blocks.end(); ++record, ++pageRecord)
+        {
+            ASSERT_NE(pageRecord, page.end());
+            ASSERT_EQ(pageRecord->getRecord(), record->getRecord());
+        }
+        ASSERT_EQ(pageRecord, page.end());
+    }
+
+    // Extended address sections include the section record
+    HexSection linear{HexSection::makeExtendedLinearAddressSection(0x1234)};
+    linear.setStorageType(HexSectionStorageType::STORAGE_PAGE);
+    ASSERT_EQ(linear.getSize(), 1);
+    linear.setData(0x0100, 0x44);
+    ASSERT_EQ(linear.getSize(), 2);
+    ASSERT_EQ(linear.getRecord(0).getRecordType(), HexRecordType::RECORD_EXTENDED_LINEAR_ADDRESS);
+    ASSERT_EQ(linear.getRecord(1).getAddress(), 0x0100);
+    ASSERT_EQ(linear.getDataMap().at(0x12340100), 1);
+    size_t count{0};
+    for (auto record{linear.begin()}; record != linear.end(); ++record)
+        count++;
+    ASSERT_EQ(count, 2);
+
+    // Records pushed to the page
+    HexSection pushed{HexSectionType::SECTION_DATA};
+    pushed.setStorageType(HexSectionStorageType::STORAGE_PAGE);
+    ASSERT_TRUE(pushed.pushRecord(":0400100001020304E2"));
+    ASSERT_FALSE(pushed.canPushRecord(":00000001FF"));
+    ASSERT_EQ(pushed.getData(0x0013), 0x04);
+
+    // Conversion back to the blocks keeps the data and the compact layout
+    auto records{page.getSize()};
+    page.setStorageType(HexSectionStorageType::STORAGE_BLOCKS);
+    ASSERT_EQ(page.getStorageType(), HexSectionStorageType::STORAGE_BLOCKS);
+    ASSERT_EQ(page.getSize(), records);
+    ASSERT_EQ(page.getDataMap(), blocks.getDataMap());
+
+    // Converting removes the data of the page
+    pushed.convertToEndOfFileSection();
+    pushed.convertToDataSection();
+    ASSERT_FALSE(pushed.hasData());
+}
+
+void HexSectionTest::performLookupTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Blocks of 8 bytes with 8 byte gaps
+    HexSection section{HexSectionType::SECTION_DATA};
+    for (HexDataAddressType address{0}; address < 0x8000; address += 0x10)
+        ASSERT_EQ(section.setData(address, HexDataVector(8, static_cast<HexDataType>(address >> 4)), 8, 0), 8);
+
+    ASSERT_EQ(section.getSize(), 0x800);
+
+    // Checks the data and the records at the address
+    auto check{[](const HexSection& checked, HexDataAddressType address)
+    {
+        const auto index{static_cast<size_t>(address >> 4)};
+        if ((address < 0x8000) && ((address & 0x08) == 0))
+        {
+            ASSERT_EQ(checked.getData(address), static_cast<HexDataType>(address >> 4));
+            ASSERT_EQ(checked[address], static_cast<HexDataType>(address >> 4));
+            ASSERT_EQ(checked.findAddress(address), index);
+        }
+        else
+        {
+            ASSERT_EQ(checked.getData(address), checked.getUnusedDataFillValue());
+            ASSERT_THROW(checked[address], std::out_of_range);
+            ASSERT_EQ(checked.findAddress(address), std::string::npos);
+        }
+
+        // Previous record starts before the address, next record ends after it
+        const auto previous{(address > 0) ? std::min(static_cast<size_t>((address - 1) >> 4), static_cast<size_t>(0x7FF)) : std::string::npos};
+        const auto next{((address & 0x0F) < 0x07) ? index : (index + 1)};
+        ASSERT_EQ(checked.findPreviousRecord(address), previous);
+        ASSERT_EQ(checked.findNextRecord(address), ((next < 0x800) ? next : std::string::npos));
+    }};
+
+    // Sequential, backward and random access
+    for (HexDataAddressType address{0}; address < 0x8100; ++address)
+        check(section, address);
+
+    for (HexDataAddressType address{0x8100}; address > 0; --address)
+        check(section, address);
+
+    uint32_t seed{1};
+    for (size_t count{0}; count < 0x4000; ++count)
+    {
+        seed = (seed * 1103515245) + 12345;
+        check(section, static_cast<HexDataAddressType>((seed >> 8) & 0xFFFF));
+    }
+
+    // Lookups after removing and adding blocks
+    ASSERT_EQ(section.getData(0x1000), 0x00);
+    section.clearData(0x1000, 8);
+    ASSERT_EQ(section.getData(0x1000), section.getUnusedDataFillValue());
+    ASSERT_EQ(section.getData(0x1010), 0x01);
+    section.clearData(0x1010);
+    section.clearData(0x1011, 7);
+    ASSERT_EQ(section.findAddress(0x1010), std::string::npos);
+    ASSERT_EQ(section.findNextRecord(0x1000), 0x100);
+    section.setData(0x1008, 0xAA);
+    ASSERT_EQ(section.getData(0x1008), 0xAA);
+    ASSERT_EQ(section.findAddress(0x1008), 0x100);
+    section.compact();
+    ASSERT_EQ(section.getData(0x1020), 0x02);
+    section.clearData();
+    ASSERT_EQ(section.getData(0x1020), section.getUnusedDataFillValue());
+
+    // Copies and moves use their own blocks
+    HexSection original{HexSectionType::SECTION_DATA};
+    original.setData(0x0100, HexDataVector{0x01, 0x02}, 2, 0);
+    original.setData(0x0200, HexDataVector{0x03, 0x04}, 2, 0);
+    ASSERT_EQ(original.getData(0x0201), 0x04);
+
+    HexSection copy{original};
+    HexSection assigned{HexSectionType::SECTION_DATA};
+    assigned.setData(0x0300, 0x05);
+    ASSERT_EQ(assigned.getData(0x0300), 0x05);
+    assigned = original;
+    copy.setData(0x0201, 0x14);
+    assigned.setData(0x0201, 0x24);
+    ASSERT_EQ(original.getData(0x0201), 0x04);
+    ASSERT_EQ(copy.getData(0x0201), 0x14);
+    ASSERT_EQ(assigned.getData(0x0201), 0x24);
+    ASSERT_EQ(assigned.getData(0x0300), assigned.getUnusedDataFillValue());
+
+    static_assert(std::is_nothrow_move_constructible<HexSection>::value, "HexSection has to be nothrow move constructible");
+    HexSection moved{std::move(copy)};
+    ASSERT_EQ(moved.getData(0x0201), 0x14);
+    HexSection moveAssigned{HexSectionType::SECTION_DATA};
+    ASSERT_EQ(moveAssigned.getData(0x0201), moveAssigned.getUnusedDataFillValue());
+    moveAssigned = std::move(moved);
+    ASSERT_EQ(moveAssigned.getData(0x0201), 0x14);
+    ASSERT_EQ(moveAssigned.getData(0x0100), 0x01);
+}
+
+void HexSectionTest::performPushLayoutTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Pushed records have the same layout as data set byte by byte
+    uint32_t seed{7};
+    auto random{[&seed](uint32_t range)
+    {
+        seed = (seed * 1103515245) + 12345;
+        return ((seed >> 8) % range);
+    }};
+
+    for (HexDataSizeType defaultDataSize : {2, 16, 32})
+    {
+        HexSection pushed{HexSectionType::SECTION_DATA};
+        HexSection expected{HexSectionType::SECTION_DATA};
+        pushed.setDefaultDataSize(defaultDataSize);
+        expected.setDefaultDataSize(defaultDataSize);
+
+        for (size_t count{0}; count < 400; ++count)
+        {
+            // Overlapping records of random sizes in a small range
+            const auto address{static_cast<HexDataAddressType>(0x1000 + random(0x200))};
+            HexDataVector data(random(40) + 1);
+            for (auto& item : data)
+                item = static_cast<HexDataType>(random(0x100));
+
+            HexRecord record{};
+            record.prepareDataRecord(address, data);
+            ASSERT_TRUE(pushed.pushRecord(record));
+            for (size_t index{0}; index < data.size(); ++index)
+                expected.setData(address + static_cast<HexDataAddressType>(index), data.at(index));
+
+            // Clear some data to make gaps
+            if (random(8) == 0)
+            {
+                const auto clearAddress{static_cast<HexDataAddressType>(0x1000 + random(0x200))};
+                const auto clearSize{static_cast<HexDataSizeType>(random(20) + 1)};
+                pushed.clearData(clearAddress, clearSize);
+                expected.clearData(clearAddress, clearSize);
+            }
+        }
+
+        ASSERT_EQ(pushed.getSize(), expected.getSize());
+        for (size_t index{0}; index < expected.getSize(); ++index)
+            ASSERT_EQ(pushed.getRecord(index).getRecord(), expected.getRecord(index).getRecord());
+    }
+
+    // Data past the end of the section wraps around
+    HexSection wrapped{HexSectionType::SECTION_DATA};
+    ASSERT_TRUE(wrapped.pushRecord(":04FFFE0001020304F5"));
+    ASSERT_EQ(wrapped.getSize(), 2);
+    ASSERT_EQ(wrapped.getData(0xFFFE), 0x01);
+    ASSERT_EQ(wrapped.getData(0xFFFF), 0x02);
+    ASSERT_EQ(wrapped.getData(0x0000), 0x03);
+    ASSERT_EQ(wrapped.getData(0x0001), 0x04);
+
+    wrapped.setStorageType(HexSectionStorageType::STORAGE_PAGE);
+    wrapped.clearData();
+    ASSERT_TRUE(wrapped.pushRecord(":04FFFE0001020304F5"));
+    ASSERT_EQ(wrapped.getData(0xFFFF), 0x02);
+    ASSERT_EQ(wrapped.getData(0x0000), 0x03);
+}
+
+void HexSectionTest::performAllocatorTests()
+{
+    SCOPED_TRACE(__func__);
+
+    CountingResource resource{};
+    {
+        // Data blocks are allocated with the allocator
+        HexSection section{HexSectionType::SECTION_DATA, &resource};
+        ASSERT_EQ(section.get_allocator().resource(), &resource);
+        ASSERT_EQ(resource.allocations, 0);
+        ASSERT_TRUE(section.pushRecord(":10010000214601360121470136007EFE09D2190140"));
+        section.setData(0x2000, 0x5A);
+        ASSERT_GT(resource.allocations, 0);
+        ASSERT_GT(resource.allocated, 0);
+
+        // Copies use the default memory resource unless provided with the allocator
+        const auto allocations{resource.allocations};
+        HexSection copy{section};
+        ASSERT_NE(copy.get_allocator().resource(), &resource);
+        ASSERT_EQ(resource.allocations, allocations);
+        ASSERT_EQ(copy.getDataMap(), section.getDataMap());
+
+        HexSection allocatorCopy{copy, &resource};
+        ASSERT_EQ(allocatorCopy.get_allocator().resource(), &resource);
+        ASSERT_GT(resource.allocations, allocations);
+        ASSERT_EQ(allocatorCopy.getDataMap(), section.getDataMap());
+        ASSERT_EQ(allocatorCopy.getData(0x0100), 0x21);
+
+        // Moves with a different allocator copy the data
+        HexSection moved{std::move(allocatorCopy), std::pmr::new_delete_resource()};
+        ASSERT_EQ(moved.getDataMap(), section.getDataMap());
+        ASSERT_EQ(moved.getData(0x2000), 0x5A);
+
+        // Page storage is allocated with the allocator
+        const auto allocated{resource.allocated};
+        section.setStorageType(HexSectionStorageType::STORAGE_PAGE);
+        ASSERT_GE(resource.allocated, allocated - 0x20 + HEX_PAGE_SIZE);
+        ASSERT_EQ(section.getData(0x0100), 0x21);
+        section.setStorageType(HexSectionStorageType::STORAGE_BLOCKS);
+        ASSERT_LT(resource.allocated, HEX_PAGE_SIZE);
+
+        // Sections in a vector use the allocator of the vector
+        HexSectionVector sections{&resource};
+        sections.push_back(copy);
+        sections.push_back(copy);
+        ASSERT_EQ(sections.front().get_allocator().resource(), &resource);
+        ASSERT_EQ(sections.back().getData(0x2000), 0x5A);
+    }
+
+    // Everything is released
+    ASSERT_EQ(resource.allocated, 0);
+}
+
+void HexSectionTest::performCopyOnWriteTests()
+{
+    SCOPED_TRACE(__func__);
+
+    for (auto storageType : {HexSectionStorageType::STORAGE_BLOCKS, HexSectionStorageType::STORAGE_PAGE})
+    {
+        CountingResource resource{};
+        HexSection original{HexSectionType::SECTION_DATA, &resource};
+        original.setStorageType(storageType);
+        ASSERT_TRUE(original.pushRecord(":10010000214601360121470136007EFE09D2190140"));
+        ASSERT_TRUE(original.pushRecord(":100110002146017E17C20001FF5F16002148011928"));
+        const auto expected{original.getDataMap()};
+
+        // Copies share the data
+        HexSectionVector copies{&resource};
+        copies.reserve(8);
+        const auto allocations{resource.allocations};
+        HexSection copy{original, &resource};
+        for (size_t index{0}; index < 8; ++index)
+            copies.push_back(original);
+
+        ASSERT_EQ(resource.allocations, allocations);
+        ASSERT_EQ(copy.getDataMap(), expected);
+        ASSERT_EQ(copies.back().getData(0x0110), 0x21);
+
+        // Modified copy copies the data, the original is not changed
+        copy.setData(0x0100, 0xAA);
+        ASSERT_GT(resource.allocations, allocations);
+        ASSERT_EQ(copy.getData(0x0100), 0xAA);
+        ASSERT_EQ(original.getData(0x0100), 0x21);
+        ASSERT_EQ(copies.front().getData(0x0100), 0x21);
+
+        // Every modifying function copies the data
+        auto modifications{std::vector<std::function<void(HexSection&)>>{
+            [](HexSection& section) { section[0x0101] = 0x55; },
+            [](HexSection& section) { section.setData(0x0102, HexDataVector{0x01, 0x02}, 2, 0); },
+            [](HexSection& section) { const HexDataType data[]{0x03, 0x04}; section.setData(0x0200, data, 2); },
+            [](HexSection& section) { section.fillData(0x0104, 4, 0x77); },
+            [](HexSection& section) { section.clearData(0x0108); },
+            [](HexSection& section) { section.clearData(0x0109, 3); },
+            [](HexSection& section) { section.clearData(); },
+            [](HexSection& section) { section.pushRecord(":0201200001FFDD"); },
+            [](HexSection& section) { section.compact(); },
+            [](HexSection& section) { section.convertToEndOfFileSection(); },
+            [](HexSection& section) { section.setStorageType(HexSectionStorageType::STORAGE_BLOCKS); section.setStorageType(HexSectionStorageType::STORAGE_PAGE); }
+        }};
+
+        for (size_t index{0}; index < modifications.size(); ++index)
+        {
+            modifications.at(index)(copies.at(index % copies.size()));
+            ASSERT_EQ(original.getDataMap(), expected);
+        }
+
+        // Assigned sections share the data too
+        HexSection assigned{HexSectionType::SECTION_DATA};
+        assigned = copy;
+        assigned.setData(0x0100, 0xBB);
+        ASSERT_EQ(copy.getData(0x0100), 0xAA);
+        ASSERT_EQ(assigned.getData(0x0100), 0xBB);
+
+        // Moved section keeps the data, the moved-from section is empty
+        HexSection moved{std::move(copy)};
+        ASSERT_EQ(moved.getData(0x0100), 0xAA);
+        ASSERT_FALSE(copy.hasData());
+        copy.setData(0x0000, 0x11);
+        ASSERT_EQ(copy.getData(0x0000), 0x11);
+        ASSERT_EQ(moved.getData(0x0000), moved.getUnusedDataFillValue());
+    }
+}
+
+void HexSectionTest::performDataReferenceTests()
+{
+    SCOPED_TRACE(__func__);
+
+    for (auto storageType : {HexSectionStorageType::STORAGE_BLOCKS, HexSectionStorageType::STORAGE_PAGE})
+    {
+        HexSection section{HexSectionType::SECTION_DATA};
+        section.setStorageType(storageType);
+        section.setData(0x0000, 0x11);
+
+        // Copy made after the data is referenced does not see the writes through the reference
+        auto& reference{section[0x0000]};
+        HexSection copy{section};
+        reference = 0x22;
+        ASSERT_EQ(section.getData(0x0000), 0x22);
+        ASSERT_EQ(copy.getData(0x0000), 0x11);
+
+        // Assigned section does not see them either
+        HexSection assigned{HexSectionType::SECTION_DATA};
+        assigned = section;
+        reference = 0x33;
+        ASSERT_EQ(section.getData(0x0000), 0x33);
+        ASSERT_EQ(assigned.getData(0x0000), 0x22);
+
+        // Moved section keeps the referenced data
+        HexSectionVector sections{};
+        sections.push_back(std::move(section));
+        reference = 0x44;
+        ASSERT_EQ(sections.back().getData(0x0000), 0x44);
+
+        // Copies of the moved section do not see the writes
+        HexSection movedCopy{sections.back()};
+        reference = 0x55;
+        ASSERT_EQ(sections.back().getData(0x0000), 0x55);
+        ASSERT_EQ(movedCopy.getData(0x0000), 0x44);
+
+        // Copies of the sections without references still share the data
+        HexSection copyOfCopy{copy};
+        copyOfCopy.setData(0x0000, 0x66);
+        ASSERT_EQ(copy.getData(0x0000), 0x11);
+        ASSERT_EQ(copyOfCopy.getData(0x0000), 0x66);
+    }
+}
+
 END_NAMESPACE_LIBIHEX
@@ -0,0 +1,193 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <ihex/hex_sink.hpp>
+#include <ihex_test/test_hex_sink_impl.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+HexSinkTest::HexSinkTest()
+{
+
+}
+
+HexSinkTest::~HexSinkTest()
+{
+
+}
+
+void HexSinkTest::SetUp()
+{
+    Test::SetUp();
+}
+
+void HexSinkTest::TearDown()
+{
+    Test::TearDown();
+}
+
+void HexSinkTest::performBufferTests()
+{
+    SCOPED_TRACE(__func__);
+
+    std::stringstream stream{};
+    {
+        HexStreamSink sink{stream, 8};
+        ASSERT_EQ(sink.getBufferSize(), 8);
+        ASSERT_EQ(sink.getPendingSize(), 0);
+
+        // Small writes are kept in the buffer
+        ASSERT_TRUE(sink.write("0123", 4));
+        ASSERT_EQ(sink.getPendingSize(), 4);
+        ASSERT_EQ(stream.str(), "");
+
+        // Write not fitting into the buffer flushes it first
+        ASSERT_TRUE(sink.write("45678", 5));
+        ASSERT_EQ(sink.getPendingSize(), 5);
+        ASSERT_EQ(stream.str(), "0123");
+
+        // Write larger than the buffer bypasses it (pending data is output first)
+        ASSERT_TRUE(sink.write("ABCDEFGHIJ", 10));
+        ASSERT_EQ(sink.getPendingSize(), 0);
+        ASSERT_EQ(stream.str(), "012345678ABCDEFGHIJ");
+
+        // Prepared space is written in place
+        auto text{sink.prepare(3)};
+        ASSERT_NE(text, nullptr);
+        std::memcpy(text, "xyz", 3);
+        sink.commit(2);
+        ASSERT_EQ(sink.getPendingSize(), 2);
+
+        // Buffer grows for the prepared space larger than the buffer
+        text = sink.prepare(16);
+        ASSERT_NE(text, nullptr);
+        ASSERT_EQ(sink.getBufferSize(), 16);
+        ASSERT_EQ(stream.str(), "012345678ABCDEFGHIJxy");
+        std::memcpy(text, "0123456789ABCDEF", 16);
+        sink.commit(16);
+
+        ASSERT_TRUE(sink.flush());
+        ASSERT_EQ(sink.getPendingSize(), 0);
+        ASSERT_EQ(stream.str(), "012345678ABCDEFGHIJxy0123456789ABCDEF");
+
+        // Pending data is flushed on destruction
+        ASSERT_TRUE(sink.write("!", 1));
+    }
+    ASSERT_EQ(stream.str(), "012345678ABCDEFGHIJxy0123456789ABCDEF!");
+
+    // Failed stream fails the output
+    std::stringstream failedStream{};
+    failedStream.setstate(std::ios_base::badbit);
+    HexStreamSink failedSink{failedStream, 4};
+    ASSERT_TRUE(failedSink.write("01", 2));
+    ASSERT_FALSE(failedSink.flush());
+    ASSERT_FALSE(failedSink.write("0123456789", 10));
+    ASSERT_TRUE(failedSink.write("01", 2));
+    ASSERT_EQ(failedSink.prepare(4), nullptr);
+}
+
+void HexSinkTest::performFileDescriptorSinkTests()
+{
+    SCOPED_TRACE(__func__);
+
+#ifdef LIBIHEX_HEX_SINK_DESCRIPTOR
+    auto file{std::tmpfile()};
+    ASSERT_NE(file, nullptr);
+
+    // Buffered writes, writes bypassing the buffer and flush on destruction
+    std::string expected;
+    {
+        HexFileDescriptorSink sink{fileno(file), 64};
+        ASSERT_EQ(sink.getDescriptor(), fileno(file));
+
+        for (size_t index{0}; index < 100; ++index)
+        {
+            std::string line{":00000001FF\n"};
+            ASSERT_TRUE(sink.write(line.data(), line.size()));
+            expected += line;
+        }
+
+        std::string large(1000, 'A');
+        ASSERT_TRUE(sink.write(large.data(), large.size()));
+        expected += large;
+
+        ASSERT_TRUE(sink.write("tail", 4));
+        expected += "tail";
+    }
+
+    // Read the file back
+    std::rewind(file);
+    std::string contents(expected.size() + 1, '\0');
+    contents.resize(std::fread(contents.data(), 1, contents.size(), file));
+    std::fclose(file);
+    ASSERT_EQ(contents, expected);
+
+    // Invalid file descriptor fails the output
+    HexFileDescriptorSink invalidSink{-1, 4};
+    ASSERT_TRUE(invalidSink.write("01", 2));
+    ASSERT_FALSE(invalidSink.flush());
+    ASSERT_FALSE(invalidSink.write("0123456789", 10));
+#endif
+}
+
+void HexSinkTest::performMemorySinkTests()
+{
+    SCOPED_TRACE(__func__);
+
+    HexMemorySink sink{16};
+    ASSERT_EQ(sink.getBufferSize(), 0);
+    ASSERT_EQ(sink.getData(), "");
+
+    // Data is appended directly
+    ASSERT_TRUE(sink.write("0123", 4));
+    ASSERT_EQ(sink.getPendingSize(), 0);
+    ASSERT_EQ(sink.getData(), "0123");
+
+    // Prepared space is appended on commit
+    auto text{sink.prepare(4)};
+    ASSERT_NE(text, nullptr);
+    std::memcpy(text, "ABCD", 4);
+    sink.commit(3);
+    ASSERT_EQ(sink.getData(), "0123ABC");
+
+    // Space prepared again replaces the space, which was not committed
+    sink.prepare(8);
+    text = sink.prepare(2);
+    std::memcpy(text, "EF", 2);
+    sink.commit(2);
+    ASSERT_EQ(sink.getData(), "0123ABCEF");
+    ASSERT_TRUE(sink.flush());
+
+    // Release and clear the data
+    ASSERT_EQ(sink.releaseData(), "0123ABCEF");
+    ASSERT_EQ(sink.getData(), "");
+
+    ASSERT_TRUE(sink.write("01", 2));
+    sink.clear();
+    ASSERT_EQ(sink.getData(), "");
+}
+
+END_NAMESPACE_LIBIHEX
@@ -0,0 +1,297 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <ihex/hex_file.hpp>
+#include <ihex/hex_record.hpp>
+#include <ihex/hex_visitor.hpp>
+#include <ihex_test/test_hex_file_assets.hpp>
+#include <ihex_test/test_hex_visitor_impl.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+void HexRecordingVisitor::onData(HexAddressType address, const HexDataType* data, HexDataSizeType dataSize)
+{
+    runs[address] = dataSize;
+    for (HexDataSizeType index{0}; index < dataSize; ++index)
+        this->data[address + index] = data[index];
+}
+
+void HexRecordingVisitor::onEndOfFile()
+{
+    ++endOfFileCount;
+}
+
+void HexRecordingVisitor::onExtendedSegmentAddress(uint16_t segmentAddress)
+{
+    this->segmentAddress = segmentAddress;
+}
+
+void HexRecordingVisitor::onStartSegmentAddress(uint16_t codeSegment, uint16_t instructionPointer)
+{
+    startSegmentAddress = ((static_cast<uint32_t>(codeSegment) << 16) | instructionPointer);
+}
+
+void HexRecordingVisitor::onExtendedLinearAddress(uint16_t linearAddress)
+{
+    this->linearAddress = linearAddress;
+}
+
+void HexRecordingVisitor::onStartLinearAddress(uint32_t extendedInstructionPointer)
+{
+    startLinearAddress = extendedInstructionPointer;
+}
+
+bool HexRecordingVisitor::onInvalidRecord(std::string_view)
+{
+    ++invalidRecordCount;
+    return continueOnError;
+}
+
+bool HexRecordingVisitor::onChecksumMismatch(std::string_view)
+{
+    ++checksumMismatchCount;
+    return continueOnError;
+}
+
+HexVisitorTest::HexVisitorTest()
+{
+
+}
+
+HexVisitorTest::~HexVisitorTest()
+{
+
+}
+
+void HexVisitorTest::SetUp()
+{
+    Test::SetUp();
+}
+
+void HexVisitorTest::TearDown()
+{
+    Test::TearDown();
+}
+
+void HexVisitorTest::performVisitTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // File, stream and memory visits report the same data as loading the file
+    for (const auto& sample : {"sample1.hex", "sample2.hex"})
+    {
+        auto fileName{std::string(TEST_HEX_FILE_ASSET_PATH) + "/" + sample};
+        std::ifstream input{fileName};
+        std::string contents{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+
+        HexFile file{};
+        ASSERT_TRUE(file.load(fileName));
+
+        HexRecordingVisitor fileVisitor{};
+        ASSERT_TRUE(fileVisitor.visit(fileName));
+
+        HexRecordingVisitor streamVisitor{};
+        std::stringstream stream{contents};
+        ASSERT_TRUE(streamVisitor.visit(stream));
+
+        HexRecordingVisitor memoryVisitor{};
+        ASSERT_TRUE(memoryVisitor.visit(contents.data(), contents.size()));
+
+        ASSERT_GT(fileVisitor.data.size(), 0);
+        ASSERT_EQ(fileVisitor.data, streamVisitor.data);
+        ASSERT_EQ(fileVisitor.data, memoryVisitor.data);
+        ASSERT_EQ(fileVisitor.runs, memoryVisitor.runs);
+        ASSERT_EQ(fileVisitor.endOfFileCount, 1);
+        ASSERT_EQ(memoryVisitor.endOfFileCount, 1);
+        for (const auto& [address, value] : fileVisitor.data)
+            ASSERT_EQ(file.getData(address), value);
+    }
+
+    // Missing file
+    HexRecordingVisitor visitor{};
+    ASSERT_FALSE(visitor.visit(std::string(TEST_HEX_FILE_ASSET_PATH) + "/missing_sample.hex"));
+
+    // Empty lines, carriage returns and missing trailing line separator
+    std::string contents{"\n:04000000D8BCDA7816\r\n\n:06700000505D6C94AFA589\r\n:00000001FF"};
+    std::stringstream stream{contents};
+    ASSERT_TRUE(visitor.visit(stream));
+    ASSERT_EQ(visitor.runs, (HexAddressMap{{0x0000, 4}, {0x7000, 6}}));
+    ASSERT_EQ(visitor.data.at(0x0003), 0x78);
+    ASSERT_EQ(visitor.data.at(0x7005), 0xA5);
+    ASSERT_EQ(visitor.endOfFileCount, 1);
+    ASSERT_EQ(visitor.getLineNumber(), 5);
+    ASSERT_EQ(visitor.getLineOffset(), contents.size() - 11);
+
+    // Single lines
+    ASSERT_TRUE(visitor.visitLine(""));
+    ASSERT_TRUE(visitor.visitLine(":00000001FF"));
+    ASSERT_EQ(visitor.endOfFileCount, 2);
+    ASSERT_EQ(visitor.getLineNumber(), 7);
+    ASSERT_EQ(visitor.getLineOffset(), contents.size() + 1);
+
+    // Line position is kept until reset
+    visitor.reset();
+    ASSERT_EQ(visitor.getLineNumber(), 0);
+    ASSERT_EQ(visitor.getLineOffset(), 0);
+    ASSERT_TRUE(visitor.visit(contents.data(), contents.size()));
+    ASSERT_EQ(visitor.getLineNumber(), 5);
+    ASSERT_EQ(visitor.getLineOffset(), contents.size() - 11);
+}
+
+void HexVisitorTest::performAddressTests()
+{
+    SCOPED_TRACE(__func__);
+
+    const HexDataVector data{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    HexRecordingVisitor visitor{};
+
+    // ADDRESS_I8HEX relative address wraparound
+    ASSERT_EQ(visitor.getAddressType(), HexAddressEnumType::ADDRESS_I8HEX);
+    ASSERT_TRUE(visitor.visitLine(HexRecord::makeDataRecord(0xFFFE, data).getRecord()));
+    ASSERT_EQ(visitor.runs, (HexAddressMap{{0x00000, 6}, {0x0FFFE, 2}}));
+    ASSERT_EQ(visitor.data.at(0x0000), 0x02);
+
+    // ADDRESS_I16HEX segment address space wraparound
+    visitor.runs.clear();
+    ASSERT_TRUE(visitor.visitLine(HexRecord::makeExtendedSegmentAddressRecord(0xFFFF).getRecord()));
+    ASSERT_EQ(visitor.segmentAddress, 0xFFFF);
+    ASSERT_EQ(visitor.getAddressType(), HexAddressEnumType::ADDRESS_I16HEX);
+    ASSERT_EQ(visitor.getExtendedAddress(), 0xFFFF);
+    ASSERT_TRUE(visitor.visitLine(HexRecord::makeDataRecord(0x000C, data).getRecord()));
+    ASSERT_EQ(visitor.runs, (HexAddressMap{{0x00000, 4}, {0xFFFFC, 4}}));
+
+    // ADDRESS_I16HEX relative address wraparound
+    visitor.runs.clear();
+    ASSERT_TRUE(visitor.visitLine(HexRecord::makeExtendedSegmentAddressRecord(0x1000).getRecord()));
+    ASSERT_TRUE(visitor.visitLine(HexRecord::makeDataRecord(0xFFFD, data).getRecord()));
+    ASSERT_EQ(visitor.runs, (HexAddressMap{{0x10000, 5}, {0x1FFFD, 3}}));
+
+    // ADDRESS_I32HEX relative address wraparound
+    visitor.runs.clear();
+    ASSERT_TRUE(visitor.visitLine(HexRecord::makeExtendedLinearAddressRecord(0x0001).getRecord()));
+    ASSERT_EQ(visitor.linearAddress, 0x0001);
+    ASSERT_EQ(visitor.getAddressType(), HexAddressEnumType::ADDRESS_I32HEX);
+    ASSERT_TRUE(visitor.visitLine(HexRecord::makeDataRecord(0xFFFC, data).getRecord()));
+    ASSERT_EQ(visitor.runs, (HexAddressMap{{0x10000, 4}, {0x1FFFC, 4}}));
+    ASSERT_EQ(visitor.data.at(0x10000), 0x04);
+
+    // Start address records reset the address space (same as HexFile)
+    ASSERT_TRUE(visitor.visitLine(HexRecord::makeStartLinearAddressRecord(0x12345678).getRecord()));
+    ASSERT_EQ(visitor.startLinearAddress, 0x12345678);
+    ASSERT_EQ(visitor.getAddressType(), HexAddressEnumType::ADDRESS_I8HEX);
+    ASSERT_EQ(visitor.getExtendedAddress(), 0);
+
+    ASSERT_TRUE(visitor.visitLine(HexRecord::makeExtendedLinearAddressRecord(0x0002).getRecord()));
+    ASSERT_TRUE(visitor.visitLine(HexRecord::makeStartSegmentAddressRecord(0x1234, 0x5678).getRecord()));
+    ASSERT_EQ(visitor.startSegmentAddress, 0x12345678);
+    ASSERT_EQ(visitor.getAddressType(), HexAddressEnumType::ADDRESS_I8HEX);
+
+    // Address space is kept between visits until reset
+    ASSERT_TRUE(visitor.visitLine(HexRecord::makeExtendedLinearAddressRecord(0x0003).getRecord()));
+    visitor.runs.clear();
+    std::string line{HexRecord::makeDataRecord(0x0010, data).getRecord()};
+    ASSERT_TRUE(visitor.visit(line.data(), line.size()));
+    ASSERT_EQ(visitor.runs, (HexAddressMap{{0x30010, 8}}));
+    visitor.reset();
+    visitor.runs.clear();
+    ASSERT_TRUE(visitor.visit(line.data(), line.size()));
+    ASSERT_EQ(visitor.runs, (HexAddressMap{{0x00010, 8}}));
+
+    // Matches the address resolution of HexFile
+    for (const auto& extendedRecord : {HexRecord::makeExtendedSegmentAddressRecord(0xFFFF), HexRecord::makeExtendedLinearAddressRecord(0x8000)})
+    {
+        std::stringstream contents{};
+        contents << extendedRecord.getRecord() << '\n';
+        contents << HexRecord::makeDataRecord(0xFFFA, data).getRecord() << '\n';
+        contents << HexRecord::makeEndOfFileRecord().getRecord() << '\n';
+
+        HexFile file{};
+        ASSERT_TRUE(file.load(contents));
+        contents.clear();
+        contents.seekg(0);
+
+        visitor = HexRecordingVisitor{};
+        ASSERT_TRUE(visitor.visit(contents));
+        ASSERT_EQ(visitor.runs.size(), 2);
+        ASSERT_EQ(visitor.data.size(), data.size());
+        for (const auto& [address, value] : visitor.data)
+            ASSERT_EQ(file.getData(address), value);
+    }
+}
+
+void HexVisitorTest::performInvalidTests()
+{
+    SCOPED_TRACE(__func__);
+
+    std::string contents{":04000000D8BCDA7816\n:xyz\n:06700000505D6C94AFA588\n:0100000000FE\n:0200000100FF\n:00000001FF\n"};
+
+    // Errors are reported and the visit continues
+    HexRecordingVisitor visitor{};
+    ASSERT_FALSE(visitor.visit(contents.data(), contents.size()));
+    ASSERT_EQ(visitor.invalidRecordCount, 2);
+    ASSERT_EQ(visitor.checksumMismatchCount, 2);
+    ASSERT_EQ(visitor.runs, (HexAddressMap{{0x0000, 4}}));
+    ASSERT_EQ(visitor.endOfFileCount, 1);
+
+    visitor = HexRecordingVisitor{};
+    std::stringstream stream{contents};
+    ASSERT_FALSE(visitor.visit(stream));
+    ASSERT_EQ(visitor.invalidRecordCount, 2);
+    ASSERT_EQ(visitor.checksumMismatchCount, 2);
+    ASSERT_EQ(visitor.endOfFileCount, 1);
+
+    // Visit is stopped on the first error
+    visitor = HexRecordingVisitor{};
+    visitor.continueOnError = false;
+    ASSERT_FALSE(visitor.visit(contents.data(), contents.size()));
+    ASSERT_EQ(visitor.invalidRecordCount, 1);
+    ASSERT_EQ(visitor.checksumMismatchCount, 0);
+    ASSERT_EQ(visitor.endOfFileCount, 0);
+
+    visitor = HexRecordingVisitor{};
+    visitor.continueOnError = false;
+    stream.clear();
+    stream.seekg(0);
+    ASSERT_FALSE(visitor.visit(stream));
+    ASSERT_EQ(visitor.invalidRecordCount, 1);
+    ASSERT_EQ(visitor.endOfFileCount, 0);
+
+    // Single lines
+    ASSERT_FALSE(visitor.visitLine(":0"));
+    ASSERT_FALSE(visitor.visitLine(":10000000"));
+    ASSERT_FALSE(visitor.visitLine(":06700000505D6C94AFA588"));
+    ASSERT_EQ(visitor.invalidRecordCount, 3);
+    ASSERT_EQ(visitor.checksumMismatchCount, 1);
+
+    // Overlong line in a stream is truncated, trailing characters are ignored
+    visitor = HexRecordingVisitor{};
+    std::stringstream longStream{":04000000D8BCDA7816" + std::string(0x30000, '0') + "\n:00000001FF\n"};
+    ASSERT_TRUE(visitor.visit(longStream));
+    ASSERT_EQ(visitor.runs, (HexAddressMap{{0x0000, 4}}));
+    ASSERT_EQ(visitor.endOfFileCount, 1);
+}
+
+END_NAMESPACE_LIBIHEX
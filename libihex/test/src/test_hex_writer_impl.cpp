@@ -0,0 +1,268 @@
+/*
+    Copyright (C) 2021-2023  Blaž Zakrajšek
+
+    This file is part of libihex.
+
+    libihex is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    libihex is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with libihex.  If not, see <https://www.gnu.org/licenses/>.
+
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ihex/hex_file.hpp>
+#include <ihex/hex_sink.hpp>
+#include <ihex/hex_writer.hpp>
+#include <ihex_test/test_hex_writer_impl.hpp>
+
+BEGIN_NAMESPACE_LIBIHEX
+
+namespace
+{
+    /**
+     * @brief Split the records to lines
+     *
+     * @param contents Records
+     * @return std::vector<std::string> Lines
+     */
+    std::vector<std::string> getLines(const std::string& contents)
+    {
+        std::vector<std::string> lines;
+        std::istringstream stream{contents};
+        for (std::string line; std::getline(stream, line);)
+            lines.push_back(line);
+
+        return lines;
+    }
+}
+
+HexWriterTest::HexWriterTest()
+{
+
+}
+
+HexWriterTest::~HexWriterTest()
+{
+
+}
+
+void HexWriterTest::SetUp()
+{
+    Test::SetUp();
+}
+
+void HexWriterTest::TearDown()
+{
+    Test::TearDown();
+}
+
+void HexWriterTest::performConstructorTests()
+{
+    SCOPED_TRACE(__func__);
+
+    HexMemorySink sink{};
+    HexWriter writer1{sink};
+    ASSERT_EQ(writer1.getAddressType(), HexAddressEnumType::ADDRESS_I32HEX);
+    ASSERT_EQ(writer1.getRecordDataSize(), DEFAULT_HEX_RECORD_DATA_SIZE);
+    ASSERT_EQ(writer1.getWindowSize(), DEFAULT_HEX_WRITER_WINDOW_SIZE);
+    ASSERT_EQ(writer1.getLineSeparator(), "\n");
+    ASSERT_FALSE(writer1.isFinished());
+
+    HexWriter writer2{sink, HexAddressEnumType::ADDRESS_I8HEX, 32, 0x100};
+    ASSERT_EQ(writer2.getAddressType(), HexAddressEnumType::ADDRESS_I8HEX);
+    ASSERT_EQ(writer2.getRecordDataSize(), 32);
+    ASSERT_EQ(writer2.getWindowSize(), 0x100);
+
+    writer2.setLineSeparator("\r\n");
+    ASSERT_EQ(writer2.getLineSeparator(), "\r\n");
+    ASSERT_THROW(writer2.setLineSeparator(""), std::invalid_argument);
+    writer2.setLineSeparator();
+    ASSERT_EQ(writer2.getLineSeparator(), "\n");
+
+    ASSERT_THROW(HexWriter(sink, static_cast<HexAddressEnumType>(3)), std::invalid_argument);
+    ASSERT_THROW(HexWriter(sink, HexAddressEnumType::ADDRESS_I32HEX, 0), std::out_of_range);
+    ASSERT_THROW(HexWriter(sink, HexAddressEnumType::ADDRESS_I32HEX, MAXIMUM_HEX_RECORD_DATA_SIZE + 1), std::out_of_range);
+    ASSERT_THROW(HexWriter(sink, HexAddressEnumType::ADDRESS_I32HEX, DEFAULT_HEX_RECORD_DATA_SIZE, 0), std::out_of_range);
+    ASSERT_EQ(sink.getData().size(), 0);
+}
+
+void HexWriterTest::performWriteTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Sorted data is split to the records of the data size
+    HexMemorySink sink{};
+    HexWriter writer{sink, HexAddressEnumType::ADDRESS_I8HEX};
+    HexDataVector data(40);
+    for (size_t index{0}; index < data.size(); ++index)
+        data.at(index) = static_cast<HexDataType>(index);
+
+    ASSERT_TRUE(writer.write(0x1000, data.data(), 20));
+    ASSERT_TRUE(writer.write(0x1014, data.data() + 20, 20));
+    ASSERT_TRUE(writer.write(0x2000, HexDataVector{0xAA, 0xBB}));
+    ASSERT_TRUE(writer.write(0x2000, nullptr, 0));
+    ASSERT_EQ(sink.getData().size(), 0);
+    ASSERT_TRUE(writer.finish());
+
+    auto lines{getLines(sink.getData())};
+    ASSERT_EQ(lines.size(), 5);
+    ASSERT_EQ(lines.at(0), ":10100000000102030405060708090A0B0C0D0E0F68");
+    ASSERT_EQ(lines.at(1), ":10101000101112131415161718191A1B1C1D1E1F58");
+    ASSERT_EQ(lines.at(2), ":081020002021222324252627AC");
+    ASSERT_EQ(lines.at(3), ":02200000AABB79");
+    ASSERT_EQ(lines.at(4), ":00000001FF");
+
+    // Written records load back to the same data
+    HexFile file{};
+    ASSERT_TRUE(file.load(sink.getData().data(), sink.getData().size()));
+    for (size_t index{0}; index < data.size(); ++index)
+        ASSERT_EQ(file.getData(static_cast<HexAddressType>(0x1000 + index)), data.at(index));
+
+    ASSERT_EQ(file.getData(0x2001), 0xBB);
+
+    // Addresses out of range of the address type
+    HexMemorySink sink1{};
+    HexWriter writer1{sink1, HexAddressEnumType::ADDRESS_I8HEX};
+    ASSERT_THROW(writer1.write(0xFFFF, data.data(), 2), std::out_of_range);
+    ASSERT_THROW(writer1.write(0x10000, data.data(), 1), std::out_of_range);
+
+    HexWriter writer2{sink1, HexAddressEnumType::ADDRESS_I16HEX};
+    ASSERT_THROW(writer2.write(0x100000, data.data(), 1), std::out_of_range);
+
+    HexWriter writer3{sink1};
+    ASSERT_THROW(writer3.write(0xFFFFFFFF, data.data(), 2), std::out_of_range);
+    ASSERT_TRUE(writer3.write(0xFFFFFFFF, data.data(), 1));
+}
+
+void HexWriterTest::performWindowTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Unsorted data within the window is emitted in address order
+    HexMemorySink sink{};
+    HexWriter writer{sink, HexAddressEnumType::ADDRESS_I32HEX, 16, 0x100};
+    ASSERT_TRUE(writer.write(0x1008, HexDataVector(8, 0x22)));
+    ASSERT_TRUE(writer.write(0x1000, HexDataVector(8, 0x11)));
+    ASSERT_TRUE(writer.write(0x1004, HexDataVector(2, 0x33)));
+    ASSERT_EQ(sink.getData().size(), 0);
+
+    // Data past the window moves it forward and emits the data below
+    ASSERT_TRUE(writer.write(0x1180, HexDataVector(4, 0x44)));
+    ASSERT_TRUE(writer.flush());
+    auto lines{getLines(sink.getData())};
+    ASSERT_EQ(lines.size(), 2);
+    ASSERT_EQ(lines.at(0), ":101000001111111133331111222222222222222204");
+    ASSERT_EQ(lines.at(1), ":04118000444444445B");
+
+    // Data below the window or below the flushed data can not be written
+    ASSERT_THROW(writer.write(0x1010, HexDataVector(1, 0x55)), std::out_of_range);
+    ASSERT_THROW(writer.write(0x1183, HexDataVector(1, 0x55)), std::out_of_range);
+    ASSERT_TRUE(writer.write(0x1184, HexDataVector(1, 0x55)));
+
+    // Data larger than the window
+    HexDataVector data(0x1000);
+    for (size_t index{0}; index < data.size(); ++index)
+        data.at(index) = static_cast<HexDataType>(index * 7);
+
+    ASSERT_TRUE(writer.write(0x2000, data));
+    ASSERT_TRUE(writer.finish());
+
+    HexFile file{};
+    ASSERT_TRUE(file.load(sink.getData().data(), sink.getData().size()));
+    ASSERT_EQ(file.getData(0x1184), 0x55);
+    for (size_t index{0}; index < data.size(); ++index)
+        ASSERT_EQ(file.getData(static_cast<HexAddressType>(0x2000 + index)), data.at(index));
+
+    // Every data record respects the record data size
+    for (const auto& line : getLines(sink.getData()))
+        ASSERT_LE(HexRecord{line}.getDataSize(), 16);
+}
+
+void HexWriterTest::performExtendedAddressTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Extended linear address records are emitted when the upper address changes
+    HexMemorySink linearSink{};
+    HexWriter linearWriter{linearSink};
+    ASSERT_TRUE(linearWriter.write(0x0000FFF8, HexDataVector(16, 0x11)));
+    ASSERT_TRUE(linearWriter.write(0x00018000, HexDataVector(1, 0x22)));
+    ASSERT_TRUE(linearWriter.finish());
+
+    auto linearLines{getLines(linearSink.getData())};
+    ASSERT_EQ(linearLines.size(), 5);
+    ASSERT_EQ(linearLines.at(0), ":08FFF800111111111111111179");
+    ASSERT_EQ(linearLines.at(1), ":020000040001F9");
+    ASSERT_EQ(linearLines.at(2), ":08000000111111111111111170");
+    ASSERT_EQ(linearLines.at(3), ":01800000225D");
+    ASSERT_EQ(linearLines.at(4), ":00000001FF");
+
+    // Extended segment address records are emitted when the upper address changes
+    HexMemorySink segmentSink{};
+    HexWriter segmentWriter{segmentSink, HexAddressEnumType::ADDRESS_I16HEX};
+    ASSERT_TRUE(segmentWriter.write(0x12345, HexDataVector(2, 0x33)));
+    ASSERT_TRUE(segmentWriter.finish());
+
+    auto segmentLines{getLines(segmentSink.getData())};
+    ASSERT_EQ(segmentLines.size(), 3);
+    ASSERT_EQ(segmentLines.at(0), ":020000021000EC");
+    ASSERT_EQ(segmentLines.at(1), ":02234500333330");
+    ASSERT_EQ(segmentLines.at(2), ":00000001FF");
+
+    HexFile file{};
+    ASSERT_TRUE(file.load(segmentSink.getData().data(), segmentSink.getData().size()));
+    ASSERT_EQ(file.getData(0x12345), 0x33);
+    ASSERT_EQ(file.getData(0x12346), 0x33);
+}
+
+void HexWriterTest::performFinishTests()
+{
+    SCOPED_TRACE(__func__);
+
+    // Start linear address is emitted before the end of file
+    HexMemorySink linearSink{};
+    HexWriter linearWriter{linearSink};
+    ASSERT_THROW(linearWriter.setStartSegmentAddress(0x1234, 0x5678), std::domain_error);
+    linearWriter.setStartLinearAddress(0x12345678);
+    ASSERT_TRUE(linearWriter.finish());
+    ASSERT_TRUE(linearWriter.isFinished());
+    ASSERT_EQ(linearSink.getData(), ":0400000512345678E3\n:00000001FF\n");
+
+    // Finished writer does not accept data
+    ASSERT_THROW(linearWriter.write(0, HexDataVector(1, 0)), std::logic_error);
+    ASSERT_THROW(linearWriter.finish(), std::logic_error);
+
+    // Start segment address is emitted before the end of file
+    HexMemorySink segmentSink{};
+    HexWriter segmentWriter{segmentSink, HexAddressEnumType::ADDRESS_I16HEX};
+    ASSERT_THROW(segmentWriter.setStartLinearAddress(0x12345678), std::domain_error);
+    segmentWriter.setStartSegmentAddress(0x1234, 0x5678);
+    segmentWriter.setLineSeparator("\r\n");
+    ASSERT_TRUE(segmentWriter.write(0x0100, HexDataVector(1, 0x01)));
+    ASSERT_TRUE(segmentWriter.finish());
+    ASSERT_EQ(segmentSink.getData(), ":0101000001FD\r\n:0400000312345678E5\r\n:00000001FF\r\n");
+
+    // I8HEX does not support start addresses
+    HexMemorySink dataSink{};
+    HexWriter dataWriter{dataSink, HexAddressEnumType::ADDRESS_I8HEX};
+    ASSERT_THROW(dataWriter.setStartSegmentAddress(0, 0), std::domain_error);
+    ASSERT_THROW(dataWriter.setStartLinearAddress(0), std::domain_error);
+    ASSERT_TRUE(dataWriter.finish());
+    ASSERT_EQ(dataSink.getData(), ":00000001FF\n");
+}
+
+END_NAMESPACE_LIBIHEX